@@ -0,0 +1,14 @@
+#!/bin/sh
+# Native Linux builds of the game logic, for profiling and sanitizers, e.g.
+#   ./build-native.sh -fsanitize=address,undefined
+#   ./build-native.sh -fsanitize=thread && build/BatChaseHeadless --threaded --render
+# build/BatChaseHeadless plays the game without a window, build/BatChaseBench runs the benchmarks,
+# build/BatChaseBatch plays many games on all cores, build/BatChasePacker packs the assets into
+# build/BatChase.bundle and build/BatChaseFontBaker bakes build/c64.ttf into src/FontC64.h.
+FLAGS="-std=c++20 -O2 -g -pthread -Wall -Wextra -Wpedantic -Wshadow -Wno-missing-field-initializers $(pkg-config --cflags --libs libpng)"
+GAME="src/BatChase.cpp src/PlatformLinux.cpp src/NullGL.cpp src/SoftGL.cpp src/Profiler.cpp src/Mixer.cpp src/Particles.cpp"
+g++ $GAME src/Headless.cpp -o build/BatChaseHeadless -DBATCHASE_SIM_THREAD $FLAGS "$@" &&
+g++ $GAME src/Bench.cpp -o build/BatChaseBench -DNDEBUG $FLAGS "$@" &&
+g++ $GAME src/Batch.cpp -o build/BatChaseBatch -DNDEBUG $FLAGS "$@" &&
+g++ src/Packer.cpp -o build/BatChasePacker $FLAGS "$@" &&
+g++ src/FontBaker.cpp -o build/BatChaseFontBaker $FLAGS $(pkg-config --cflags --libs freetype2) "$@"
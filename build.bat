@@ -1,3 +1,3 @@
-em++ src\BatChase.cpp -o build\BatChase.html --js-library src\LibBatChase.js ^
--std=c++20 -lGL -Wall -Wextra -Wpedantic -Wshadow ^
--sMIN_WEBGL_VERSION=2 -sMINIMAL_RUNTIME=1 -sVERBOSE=1
+em++ src\BatChase.cpp src\PlatformWeb.cpp src\Profiler.cpp src\Mixer.cpp src\Particles.cpp -o build\BatChase.html --js-library src\LibBatChase.js ^
+-std=c++20 -DBATCHASE_PROFILER -msimd128 -lGL -Wall -Wextra -Wpedantic -Wshadow ^
+-sMIN_WEBGL_VERSION=2 -sMINIMAL_RUNTIME=1 -sVERBOSE=1 -sALLOW_MEMORY_GROWTH=1
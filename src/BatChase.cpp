@@ -1,33 +1,82 @@
 // cspell:disable
-#include <emscripten/html5.h>
-#include <emscripten/em_math.h>
-#include <emscripten/dom_pk_codes.h>
-#include <webgl/webgl2.h>
+#include "Game.h"
+#include "FontC64.h"
+#include "Particles.h"
+#include "Platform.h"
+#include "Profiler.h"
+#include "Simd.h"
+#include "Mixer.h"
 
 #include <algorithm>
+#include <bit>
 #include <vector>
 #include <array>
-#include <map>
+#include <atomic>
+#include <cstring>
+#include <cstddef>
+#include <climits>
 #include <cstdio>
+#include <cmath>
 #include <functional>
+#ifdef BATCHASE_SIM_THREAD
+#include <chrono>
+#include <thread>
+#ifdef __EMSCRIPTEN__
+#include <emscripten/emscripten.h>
+#endif
+#endif
 
-constexpr int GAME_WIDTH = 569;
-constexpr int GAME_HEIGHT = 388;
 constexpr int STREET_HEIGHT = 160;
+// the enemy cars drive in lanes, the outer ones at the curbs
+constexpr int NUM_LANES = 4;
+constexpr float LANE_SPACING = float(STREET_HEIGHT) / (NUM_LANES - 1);
+float lane_y(int lane) { return lane * LANE_SPACING; }
+
+// xoshiro128** by Blackman and Vigna. Seedable, so that a game can be replayed, and gives the same
+// sequence on every platform.
+struct Rng
+{
+    uint32_t s[4];
+};
+
+Rng rng;
+
+uint64_t splitmix64(uint64_t& x)
+{
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void seed_random(uint64_t seed)
+{
+    for(int i = 0; i < 4; i += 2)
+    {
+        uint64_t z = splitmix64(seed);
+        rng.s[i] = (uint32_t)z;
+        rng.s[i + 1] = (uint32_t)(z >> 32);
+    }
+}
 
-// these functions are implemented in the JS library file
-extern "C"
+uint32_t random_u32()
 {
-void load_image(GLuint glTexture, const char* url, int* width, int* height);
-void load_font(int fontId, const char* url);
-bool upload_unicode_char_to_texture(int id, int ch, int size);
-void preload_audio(int audioId, const char* url);
-void play_audio(int audioId, EM_BOOL loop);
+    auto rotl = [](uint32_t x, int k) { return (x << k) | (x >> (32 - k)); };
+    uint32_t* s = rng.s;
+    const uint32_t result = rotl(s[1] * 5, 7) * 9;
+    const uint32_t t = s[1] << 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 11);
+    return result;
 }
 
 // [min, max[
 template <typename T, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
-T random(T min, T max) { return min + T(emscripten_math_random() * (max - min)); }
+T random(T min, T max) { return min + T(random_u32() * (1.0 / 4294967296.0) * (max - min)); }
 
 float sign(float x) { return x > 0.f ? 1.f : (x < 0.f ? -1.f : 0.f); }
 
@@ -37,6 +86,11 @@ struct Image
     GLuint glTexture{};
     int width{};
     int height{};
+    // location in glTexture, in UV units, from the bottom left corner. The images are uploaded top row first, so
+    // their uvHeight is negative.
+    float u{}, v{}, uvWidth{1.f}, uvHeight{1.f};
+    bool inAtlas{};
+    bool opaque{}; // no transparent pixels, drawn without blending
 };
 
 // In the same order as images array
@@ -62,10 +116,10 @@ enum ImageId
 };
 std::array<Image, IMG_NUM_ELEMS> images{{
     {},
-    { "title.png" },
-    { "endscreen.png" },
+    { .url = "title.png", .opaque = true },
+    { .url = "endscreen.png", .opaque = true },
     { "scorebar.png" },
-    { "road.png" },
+    { .url = "road.png", .opaque = true },
     { "batman.png" },
     { "life.png" },
     { "car1.png" },
@@ -93,69 +147,253 @@ GLuint create_program(GLuint vertexShader, GLuint fragmentShader)
     glAttachShader(program, vertexShader);
     glAttachShader(program, fragmentShader);
     glBindAttribLocation(program, 0, "pos");
+    glBindAttribLocation(program, 1, "rect");
+    glBindAttribLocation(program, 2, "uvRect");
+    glBindAttribLocation(program, 3, "color");
     glLinkProgram(program);
     glUseProgram(program);
     return program;
 }
 
-GLuint vertexBuffer, matrixPosition, colorPosition;
+GLuint vertexBuffer, instanceBuffer;
+GLint pixelSizeUniform, indexedUniform;
+bool drawingIndexed = true; // the value of indexedUniform
+GLuint hudTexture; // see init_hud_layer()
 
-enum Tag
+enum Tag : uint8_t
 {
     TAG_NONE = 0,
     TAG_PLAYER,
     TAG_ENEMY,
-    TAG_ROAD,
-    TAG_LIFE1,
-    TAG_LIFE2,
-    TAG_LIFE3,
-    TAG_SCORE,
-    TAG_HIGH_SCORE,
-    TAG_MINUTES,
-    TAG_SECONDS
+    TAG_ROAD
+};
+
+// Per-instance data of the sprite batch, see the vertex shader in init_webgl()
+struct SpriteInstance
+{
+    float x, y, width, height;
+    float u, v, uvWidth, uvHeight;
+    uint8_t r, g, b, a;
 };
 
 constexpr int MaxTextLength = 64;
 
-struct Object
+// Sprite instances of a text object, rebuilt only when the text or its style changes
+struct TextRun
 {
-    float x{}, y{};
-    ImageId img{};
-    Tag tag{};
-    // if img == IMG_TEXT
+    std::array<SpriteInstance, MaxTextLength> instances;
+    int numInstances;
+    // the state the instances were built from
     char text[MaxTextLength];
-    float r{}, g{}, b{}, a{};
-    int fontId{}, fontSize{}, spacing{};
-    // else
-    float mass{}, velx{}, vely{};
+    float x, y, r, g, b, a;
+    int fontId, fontSize, spacing;
+};
+
+// Entity components. Each kind is stored in its own array so that the per-frame physics passes only touch
+// the transforms and physics of the entities, not their sprite or text data.
+struct Transform
+{
+    float x, y;
 };
 
-std::vector<Object> scene;
+struct Physics
+{
+    float velx, vely, mass;
+    float width, height;
+    // position in the broad phase's sorted order on the previous frame, -1 if not there yet
+    int broadphaseRank{-1};
+};
 
-int find_sprite_index(Tag tag)
+// The traffic AI's state of an enemy car
+struct Driver
 {
-    for(size_t i = 0; i < scene.size(); ++i)
-        if (scene[i].tag == tag)
-            return i;
-    return -1;
+    float cruiseVelx; // the speed the car drives at on a free road, 0 if nobody drives it: it keeps its velocity
+    float laneY; // y of the lane the car keeps to, or is changing to
+};
+
+struct Sprite
+{
+    ImageId img;
+    int text; // index to World::texts if img == IMG_TEXT
+};
+
+struct Text
+{
+    char text[MaxTextLength];
+    float r, g, b, a;
+    int fontId, fontSize, spacing;
+    TextRun run;
+    bool hasRun;
+    uint32_t owner; // slot of the entity
+};
+
+// What the HUD under the road shows. The renderer keeps it drawn in a texture of its own and redraws that only
+// when this changes.
+struct Hud
+{
+    bool visible;
+    int score, highScore; // in tens of points, as shown
+    int minutes, seconds;
+    int lives;
+    bool highScoreBlink; // red while the player is setting a new high score
+    bool operator==(const Hud&) const = default;
+};
+
+// Handle to an entity. It stays valid when other entities are removed, and the generation tells apart
+// a removed entity from a new one that has reused its slot.
+struct Entity
+{
+    uint32_t slot{~0u};
+    uint32_t generation{};
+};
+
+// The entities are densely packed in drawing order, removing one moves the last entity into the hole.
+// Road and player are created first and only cars get removed during a game, so a car moved into a hole is
+// never drawn under the road or the player.
+struct World
+{
+    // one element per entity
+    std::vector<Transform> transforms;
+    // transforms at the start of the current tick, for interpolating the rendered positions
+    std::vector<Transform> prevTransforms;
+    std::vector<Physics> physics;
+    std::vector<Driver> drivers;
+    std::vector<Sprite> sprites;
+    std::vector<Tag> tags;
+    std::vector<uint32_t> slots;
+    // text components, indexed by Sprite::text
+    std::vector<Text> texts;
+    // indexed by the slot of an entity handle
+    std::vector<uint32_t> indices;
+    std::vector<uint32_t> generations;
+    std::vector<uint32_t> freeSlots;
+};
+
+// The world's arrays are allocated for this many entities up front, so that spawning cars during a game never
+// grows them. The game spawns no more than this, the benchmarks may.
+constexpr size_t MAX_ENTITIES = 512;
+constexpr size_t MAX_TEXTS = 8;
+
+World world;
+Hud hud;
+
+size_t num_entities() { return world.tags.size(); }
+
+void reserve_world()
+{
+    world.transforms.reserve(MAX_ENTITIES);
+    world.prevTransforms.reserve(MAX_ENTITIES);
+    world.physics.reserve(MAX_ENTITIES);
+    world.drivers.reserve(MAX_ENTITIES);
+    world.sprites.reserve(MAX_ENTITIES);
+    world.tags.reserve(MAX_ENTITIES);
+    world.slots.reserve(MAX_ENTITIES);
+    world.texts.reserve(MAX_TEXTS);
+    world.indices.reserve(MAX_ENTITIES);
+    world.generations.reserve(MAX_ENTITIES);
+    world.freeSlots.reserve(MAX_ENTITIES);
+}
+
+Entity create_entity(ImageId img, float x, float y, Tag tag = TAG_NONE, const Physics& physics = {})
+{
+    uint32_t slot;
+    if (world.freeSlots.empty())
+    {
+        slot = world.generations.size();
+        world.generations.push_back(0);
+        world.indices.push_back(0);
+    }
+    else
+    {
+        slot = world.freeSlots.back();
+        world.freeSlots.pop_back();
+    }
+
+    world.indices[slot] = num_entities();
+    world.transforms.push_back({ x, y });
+    world.prevTransforms.push_back({ x, y });
+    world.physics.push_back(physics);
+    world.drivers.push_back({});
+    world.sprites.push_back({ img, -1 });
+    world.tags.push_back(tag);
+    world.slots.push_back(slot);
+    return { slot, world.generations[slot] };
 }
 
-Object* find_sprite(Tag tag)
+// Returns the index of the entity in the component arrays, or -1 if it has been removed.
+int get_index(Entity e)
 {
-    int i = find_sprite_index(tag);
-    return (i >= 0) ? &scene[i] : 0;
+    if (e.slot >= world.generations.size() || world.generations[e.slot] != e.generation)
+        return -1;
+    return world.indices[e.slot];
 }
 
-void remove_sprite_at_index(int i)
+Text& get_text(Entity e) { return world.texts[world.sprites[get_index(e)].text]; }
+
+void remove_entity_at_index(size_t i)
 {
-    scene.erase(scene.begin() + i);
+    // bumping the generation invalidates the handles to the slot
+    ++world.generations[world.slots[i]];
+    world.freeSlots.push_back(world.slots[i]);
+
+    const int text = world.sprites[i].text;
+    if (text >= 0)
+    {
+        const int lastText = world.texts.size() - 1;
+        if (text != lastText)
+        {
+            world.texts[text] = std::move(world.texts[lastText]);
+            world.sprites[world.indices[world.texts[text].owner]].text = text;
+        }
+        world.texts.pop_back();
+    }
+
+    auto swapRemove = [i](auto& v)
+    {
+        v[i] = v.back();
+        v.pop_back();
+    };
+    swapRemove(world.transforms);
+    swapRemove(world.prevTransforms);
+    swapRemove(world.physics);
+    swapRemove(world.drivers);
+    swapRemove(world.sprites);
+    swapRemove(world.tags);
+    swapRemove(world.slots);
+    if (i < num_entities())
+        world.indices[world.slots[i]] = i;
 }
 
-void remove_sprite(Tag tag)
+void remove_entity(Entity e)
 {
-    int i = find_sprite_index(tag);
+    int i = get_index(e);
     if (i >= 0)
-        remove_sprite_at_index(i);
+        remove_entity_at_index(i);
+}
+
+// Changes whenever the world is replaced, i.e. when a room is entered or a snapshot restored, or a static room
+// changes its texts. The static rooms are only redrawn when it has changed since the last frame (game_frame()).
+uint32_t sceneVersion;
+
+void clear_world()
+{
+    ++sceneVersion;
+    for(uint32_t slot : world.slots)
+    {
+        ++world.generations[slot];
+        world.freeSlots.push_back(slot);
+    }
+    world.transforms.clear();
+    world.prevTransforms.clear();
+    world.physics.clear();
+    world.drivers.clear();
+    world.sprites.clear();
+    world.tags.clear();
+    world.slots.clear();
+    world.texts.clear();
+    clear_particles();
+    // the rooms start from an empty screen
+    hud = {};
 }
 
 enum AudioId
@@ -185,8 +423,19 @@ std::array<const char *, AUDIO_NUMELEMS> audioUrls{
     "c7.wav",
     "c8.wav" 
 }};
+static_assert(AUDIO_NUMELEMS <= MIXER_MAX_SOUNDS);
+
+// The music and the crashes are mixed at half volume, so that a few of them playing at once still have headroom
+// before the mixer clips its output to [-1, 1]
+constexpr float AUDIO_GAIN = 0.5f;
+
+TextureMemory textureMemory;
+
+TextureMemory texture_memory() { return textureMemory; }
 
-GLuint create_texture()
+// Immutable textures: the storage is allocated once, then filled with glTexSubImage2D(). internalFormat is GL_R8
+// for the index textures and GL_RGBA8 otherwise.
+GLuint create_texture(GLenum internalFormat, int width, int height)
 {
     GLuint tex;
     glGenTextures(1, &tex);
@@ -195,465 +444,2281 @@ GLuint create_texture()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexStorage2D(GL_TEXTURE_2D, 1, internalFormat, width, height);
+    const size_t texels = size_t(width) * height;
+    textureMemory.bytes += texels * (internalFormat == GL_R8 ? 1 : 4);
+    textureMemory.rgbaSpritesBytes += texels * 4;
     return tex;
 }
 
-void draw_image(GLuint glTexture, float x, float y, float width, float height, float r = 1.f, float g = 1.f, float b = 1.f, float a = 1.f)
-{
-    const float pixelWidth = 2.f / GAME_WIDTH;
-    const float pixelHeight = 2.f / GAME_HEIGHT;
-    float spriteMatrix[16] = {
-        width * pixelWidth, 0, 0, 0,
-        0, height * pixelHeight, 0, 0,
-        0, 0, 1, 0,
-        (int)x * pixelWidth - 1.f, (int)y * pixelHeight - 1.f, 0, 1};
-
-    glUniformMatrix4fv(matrixPosition, 1, 0, spriteMatrix);
-    glUniform4f(colorPosition, r, g, b, a);
-    glBindTexture(GL_TEXTURE_2D, glTexture);
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-}
-
-enum { FONT_C64 = 0 };
+// The sprites are index textures, one byte per pixel that the fragment shader looks up in a single palette.
+// Index 0 is transparent, the colours of the images are added from 1 up as they arrive and the top PALETTE_RAMP
+// entries are white with a rising alpha, for the coverage of the glyphs and the particles.
+constexpr int PALETTE_SIZE = 256;
+constexpr int PALETTE_RAMP = 128;
+constexpr int PALETTE_RAMP_FIRST = PALETTE_SIZE - PALETTE_RAMP;
 
-// (fontId, unicodeChar, size) -> GL texture
-std::map<std::tuple<int, int, int>, Image> glyphs;
+GLuint paletteTexture; // bound to texture unit 1
+std::array<uint32_t, PALETTE_SIZE> palette; // RGBA bytes
+int paletteColors; // of the images, from 1 up
 
-Image* find_or_cache_font_char(int fontId, int unicodeChar, int size)
+void init_palette()
 {
-    auto t = std::make_tuple(fontId, unicodeChar, size);
-    auto iter = glyphs.find(t);
-    if (iter != glyphs.end())
-        return &iter->second;
-
-    Image i = { .glTexture = create_texture(), .width = size, .height = size };
-    if (upload_unicode_char_to_texture(fontId, unicodeChar, size))
+    palette.fill(0);
+    paletteColors = 1;
+    for(int i = 0; i < PALETTE_RAMP; ++i)
     {
-        glyphs[t] = i;
-        return &glyphs[t];
+        const uint8_t white[4] = { 255, 255, 255, (uint8_t)((i * 255 + (PALETTE_RAMP - 1) / 2) / (PALETTE_RAMP - 1)) };
+        std::memcpy(&palette[PALETTE_RAMP_FIRST + i], white, 4);
     }
+}
 
-    return 0;
+void upload_palette()
+{
+    glActiveTexture(GL_TEXTURE1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, PALETTE_SIZE, 1, GL_RGBA, GL_UNSIGNED_BYTE, palette.data());
+    glActiveTexture(GL_TEXTURE0);
 }
 
-void draw_text(
-    float x, float y, float r, float g, float b, float a,
-    const char *str, int fontId, int size, float spacing)
+// Returns the palette index of an RGBA colour, adding the colour if it is new. Once the palette is full the
+// closest colour stands in for it.
+uint8_t palette_index(const uint8_t* color)
 {
-    for(; *str; ++str)
+    if (color[3] == 0)
+        return 0;
+    uint32_t rgba;
+    std::memcpy(&rgba, color, 4);
+    for(int i = 1; i < paletteColors; ++i)
+        if (palette[i] == rgba)
+            return i;
+    if (paletteColors < PALETTE_RAMP_FIRST)
+    {
+        palette[paletteColors] = rgba;
+        return paletteColors++;
+    }
+    int closest = 0, closestDistance = INT_MAX;
+    for(int i = 1; i < PALETTE_SIZE; ++i)
     {
-        Image *i = find_or_cache_font_char(fontId, *str, size);
-        if (i)
-            draw_image(i->glTexture, x, y, i->width, i->height, r, g, b, a);
-        x += spacing;
+        const uint8_t* entry = (const uint8_t*)&palette[i];
+        int distance = 0;
+        for(int k = 0; k < 4; ++k)
+            distance += (entry[k] - color[k]) * (entry[k] - color[k]);
+        if (distance < closestDistance)
+        {
+            closest = i;
+            closestDistance = distance;
+        }
     }
+    return closest;
 }
 
-void ResizeCanvas(double windowInnerWidth, double windowInnerHeight)
+// The ramp entry of white with the given alpha
+uint8_t coverage_index(uint8_t alpha)
 {
-    double scale = std::min(windowInnerWidth / GAME_WIDTH,  windowInnerHeight / GAME_HEIGHT);
-    emscripten_set_element_css_size("canvas", scale * GAME_WIDTH, scale * GAME_HEIGHT);
-    emscripten_set_canvas_element_size("canvas", GAME_WIDTH, GAME_HEIGHT);
+    return alpha == 0 ? 0 : PALETTE_RAMP_FIRST + (alpha * (PALETTE_RAMP - 1) + 127) / 255;
 }
 
-EM_BOOL ResizeHandler(int /* eventType */, const EmscriptenUiEvent* uiEvent, void* /* userData */)
-{
-    ResizeCanvas(uiEvent->windowInnerWidth, uiEvent->windowInnerHeight);
-    return EM_FALSE;
-}
+std::vector<uint8_t> decodedIndices;
 
-void init_webgl()
+// Copies a decoded image (see Platform.h) into decodedIndices with its colours mapped to the shared palette
+void copy_image_into_palette(int imageId, int width, int height, int colors)
 {
-    EM_ASM(document.body.style = 'margin: 0px; overflow: hidden; background: #787878;');
-    EM_ASM(document.querySelector('canvas').style['imageRendering'] = 'pixelated');
+    uint8_t colours[PALETTE_SIZE * 4];
+    decodedIndices.resize(size_t(width) * height);
+    copy_decoded_image(imageId, decodedIndices.data(), colours);
+    uint8_t indices[PALETTE_SIZE] = {};
+    for(int i = 0; i < std::min(colors, PALETTE_SIZE); ++i)
+        indices[i] = palette_index(colours + 4 * i);
+    for(uint8_t& index : decodedIndices)
+        index = indices[index];
+    upload_palette();
+}
 
-    ResizeCanvas(EM_ASM_DOUBLE(return window.innerWidth), EM_ASM_DOUBLE(return window.innerHeight));
+// All sprite images are packed into one big texture so that the whole scene can be drawn with a single draw call.
+constexpr int ATLAS_WIDTH = 4096;
+constexpr int ATLAS_HEIGHT = 1024;
+// Shelf heights are rounded up so that similarly sized images (e.g. all the cars) share a shelf regardless of their load order.
+constexpr int ATLAS_SHELF_ROUNDING = 32;
+constexpr int ATLAS_PADDING = 1;
 
-    EmscriptenWebGLContextAttributes attrs;
-    emscripten_webgl_init_context_attributes(&attrs);
-    attrs.alpha = EM_FALSE;
-    attrs.majorVersion = 2;
-    emscripten_webgl_make_context_current(
-        emscripten_webgl_create_context("canvas", &attrs)
-    );
+GLuint atlasTexture;
+uint32_t atlasVersion; // changes when images arrive in the atlas
 
-    static const char vertex_shader[] =
-    R"(
-        attribute vec4 pos;
-        varying vec2 uv;
-        uniform mat4 mat;
-        void main()
-        {
-            uv = pos.xy;
-            gl_Position= mat * pos;
-        }
-    )";
+struct AtlasShelf
+{
+    int y, height, nextX;
+};
 
-    GLuint vs = compile_shader(GL_VERTEX_SHADER, vertex_shader);
+std::vector<AtlasShelf> atlasShelves;
 
-    static const char fragment_shader[] =
-    R"(
-        precision lowp float;
-        uniform sampler2D spriteTexture;
-        uniform vec4 constantColor;
-        varying vec2 uv;
-        void main()
+bool allocate_atlas_rect(int width, int height, int& x, int& y)
+{
+    // the padding may hang over the right edge, so that a full width image still fits
+    width += ATLAS_PADDING;
+    height += ATLAS_PADDING;
+    for(auto& shelf : atlasShelves)
+    {
+        if (height <= shelf.height && shelf.nextX + width <= ATLAS_WIDTH + ATLAS_PADDING)
         {
-            gl_FragColor = constantColor * texture2D(spriteTexture, uv);
+            x = shelf.nextX;
+            y = shelf.y;
+            shelf.nextX += width;
+            return true;
         }
-    )";
+    }
 
-    GLuint fs = compile_shader(GL_FRAGMENT_SHADER, fragment_shader);
-    GLuint program = create_program(vs, fs);
-    matrixPosition = glGetUniformLocation(program, "mat");
-    colorPosition = glGetUniformLocation(program, "constantColor");
-    // alpha blending
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    // geom. buffer
-    glGenBuffers(1, &vertexBuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
-    const float pos[] = { 0, 0, 1, 0, 0, 1, 1, 1 };
-    glBufferData(GL_ARRAY_BUFFER, sizeof(pos), pos, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(0);
-}
+    int shelfY = atlasShelves.empty() ? 0 : atlasShelves.back().y + atlasShelves.back().height;
+    int shelfHeight = (height + ATLAS_SHELF_ROUNDING - 1) / ATLAS_SHELF_ROUNDING * ATLAS_SHELF_ROUNDING;
+    if (width > ATLAS_WIDTH + ATLAS_PADDING || shelfY + shelfHeight > ATLAS_HEIGHT)
+        return false;
 
-// test code: test image
-//GLuint testImage;
-//int testImageWidth, testImageHeight;
+    atlasShelves.push_back({ shelfY, shelfHeight, width });
+    x = 0;
+    y = shelfY;
+    return true;
+}
 
-// Get center point of a sprite
-void get_center_pos(const Object& o, float &cx, float &cy)
+// Points an image of width x height to (x, y) of the atlas. The rows are uploaded top first, the flip to GL's
+// bottom up is in the UVs.
+void set_atlas_rect(Image& img, int x, int y)
 {
-    cx = o.x + images[o.img].width / 2.f;
-    cy = o.y + images[o.img].height / 2.f;
+    img.glTexture = atlasTexture;
+    img.u = float(x) / ATLAS_WIDTH;
+    img.v = float(y + img.height) / ATLAS_HEIGHT;
+    img.uvWidth = float(img.width) / ATLAS_WIDTH;
+    img.uvHeight = -float(img.height) / ATLAS_HEIGHT;
+    img.inAtlas = true;
 }
-// Laskee kahden spriten X- ja Y-leikkauksen
-void get_overlap_amount(const Object& a, const Object& b, float& x, float& y)
+
+// Asset bundle made by the packer, see Bundle.h. Without one the images are loaded from their own files.
+BundleIndex bundleIndex;
+BundleProgress bundleProgress;
+bool bundleAtlasPlaced, imageFilesRequested;
+static_assert(ATLAS_WIDTH >= BUNDLE_ATLAS_MAX_WIDTH);
+
+// -1 until the size of the bundle is known. The platform writes bundleProgress on the main thread.
+int bundle_percent_loaded()
 {
-    x = std::min(a.x + images[a.img].width - b.x, b.x + images[b.img].width - a.x);
-    y = std::min(a.y + images[a.img].height - b.y, b.y + images[b.img].height - a.y);
+    return bundleProgress.bytesTotal > 0 ? int(100.0 * bundleProgress.bytesLoaded / bundleProgress.bytesTotal) : -1;
 }
 
-float lastHitTime;
-int lives;
-float spawnTimer, score;
-float gameStartTime, highscore = 5000;
-std::function<void(float /*t*/, float /*dt*/)> currentRoom;
+// Uploads the image files that have been decoded into the atlas
+void upload_decoded_images()
+{
+    if (!imageFilesRequested)
+        return;
+    for(int i = 0; i < IMG_NUM_ELEMS; ++i)
+    {
+        Image& img = images[i];
+        int colors;
+        if (!img.url || img.inAtlas || !decoded_image_size(i, &img.width, &img.height, &colors))
+            continue;
+        copy_image_into_palette(i, img.width, img.height, colors);
 
-uint8_t keysOld[0x10000], keysNow[0x10000];
-bool touchInput, touchDown, touchStarted;
+        int x, y;
+        if (!allocate_atlas_rect(img.width, img.height, x, y))
+        {
+            std::printf("Atlas is full, cannot fit %s (%dx%d)\n", img.url, img.width, img.height);
+            // drawn from a texture of its own
+            img.glTexture = create_texture(GL_R8, img.width, img.height);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, img.width, img.height, GL_RED, GL_UNSIGNED_BYTE, decodedIndices.data());
+            img.v = 1.f;
+            img.uvHeight = -1.f;
+            img.inAtlas = true;
+            ++atlasVersion;
+            continue;
+        }
+        glBindTexture(GL_TEXTURE_2D, atlasTexture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, img.width, img.height, GL_RED, GL_UNSIGNED_BYTE, decodedIndices.data());
+        set_atlas_rect(img, x, y);
+        ++atlasVersion;
+    }
+}
 
-EM_BOOL game_tick(double t, void * /* userData */)
+int find_bundle_entry(const char* name)
 {
-    // test code: animated colour
-    // glClearColor(0.f, emscripten_math_sin(t/500.0), 0.f, 1.f);
-    // glClear(GL_COLOR_BUFFER_BIT);
+    if (bundleProgress.state != BUNDLE_INDEX_READY && bundleProgress.state != BUNDLE_DONE)
+        return -1;
+    for(uint32_t i = 0; i < bundleIndex.header.numEntries; ++i)
+        if (!std::strcmp(bundleIndex.entries[i].name, name))
+            return i;
+    return -1;
+}
 
-    // test code: test image
-    // draw_image(testImage, 0, 0, testImageWidth, testImageHeight);
+void request_image_files()
+{
+    imageFilesRequested = true;
+    for(int i = 0; i < IMG_NUM_ELEMS; ++i)
+        if (images[i].url && !images[i].inAtlas)
+            load_image(i, images[i].url);
+}
 
-    static double prevT;
-    float dt = std::min(50.f, (float)(t - prevT));
-    prevT = t;
+// Uploads the pre-built atlas of the bundle into the atlas texture and points the images to it
+void place_bundle_atlas()
+{
+    if (bundleAtlasPlaced || imageFilesRequested)
+        return;
+    if (bundleProgress.state == BUNDLE_FAILED)
+    {
+        request_image_files();
+        return;
+    }
+    const int entry = find_bundle_entry("atlas");
+    if (entry < 0 || !bundleProgress.entryReady[entry])
+        return;
 
-    if (currentRoom)
-        currentRoom(t, dt);
+    const BundleRect& size = bundleIndex.entries[entry].sprite;
+    int x, y, width, height, colors;
+    if (!decoded_image_size(bundle_image_id(entry), &width, &height, &colors) || !allocate_atlas_rect(width, height, x, y))
+    {
+        std::printf("Cannot place the bundle's atlas (%dx%d), loading the images one by one\n", size.width, size.height);
+        request_image_files();
+        return;
+    }
+    copy_image_into_palette(bundle_image_id(entry), width, height, colors);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RED, GL_UNSIGNED_BYTE, decodedIndices.data());
+    bundleAtlasPlaced = true;
+    ++atlasVersion;
 
-    for(auto& obj : scene)
+    for(uint32_t i = 0; i < bundleIndex.header.numEntries; ++i)
     {
-        if (obj.img == IMG_TEXT)
-        {
-            draw_text(obj.x, obj.y, obj.r, obj.g, obj.b, obj.a, obj.text, obj.fontId, obj.fontSize, obj.spacing);
-        }
-        else
+        const BundleEntry& sprite = bundleIndex.entries[i];
+        if (sprite.type != BUNDLE_SPRITE)
+            continue;
+        for(auto& img : images)
         {
-            const auto& img = images[obj.img];
-            draw_image(img.glTexture, obj.x, obj.y, img.width, img.height);
+            if (!img.url || std::strcmp(img.url, sprite.name))
+                continue;
+            img.width = sprite.sprite.width;
+            img.height = sprite.sprite.height;
+            set_atlas_rect(img, x + sprite.sprite.x, y + sprite.sprite.y);
         }
     }
-
-    touchStarted = false; // TODO temp. hack
-    memcpy(keysOld, keysNow, sizeof(keysOld));
-    return EM_TRUE; // continue the loop
+    // any images that the bundle doesn't have
+    request_image_files();
 }
 
-EM_BOOL KeyHandler(int eventType, const EmscriptenKeyboardEvent* keyEvent, void* /* userData */)
+void update_atlas()
 {
-    uint16_t code = (uint16_t)emscripten_compute_dom_pk_code(keyEvent->code);
-    keysNow[code] = (eventType == EMSCRIPTEN_EVENT_KEYDOWN) ? 1 : 0;
-    return EM_FALSE; // don't suppress the key event
+    place_bundle_atlas();
+    upload_decoded_images();
 }
 
-bool is_key_pressed(DOM_PK_CODE_TYPE code) { return keysNow[code] && !keysOld[code]; }
+// Flushed when full, a frame never grows it
+constexpr size_t MAX_SPRITE_BATCH = 4096;
+std::vector<SpriteInstance> spriteBatch;
+GLuint spriteBatchTexture;
 
-bool is_key_down(DOM_PK_CODE_TYPE code) { return keysNow[code]; }
+RenderStats renderStats;
 
-void EnterTitle();
-void EnterGame();
-void EnterEndScreen();
+RenderStats last_render_stats() { return renderStats; }
 
-EM_BOOL TouchHandler(int eventType, const EmscriptenTouchEvent* /* touchEvent */, void* /* userData */)
+// One instanced draw of the sprites
+void draw_instances(GLuint glTexture, const SpriteInstance* instances, size_t count)
 {
-    touchInput = true;
-    touchStarted = (eventType == EMSCRIPTEN_EVENT_TOUCHSTART);
-    switch (eventType)
+    glBindTexture(GL_TEXTURE_2D, glTexture);
+    // the HUD layer is the one texture of colours rather than indices
+    if ((glTexture != hudTexture) != drawingIndexed)
     {
-    case EMSCRIPTEN_EVENT_TOUCHSTART:
-    case EMSCRIPTEN_EVENT_TOUCHMOVE:
-        touchDown = true;
-        break;
-    case EMSCRIPTEN_EVENT_TOUCHEND:
-    case EMSCRIPTEN_EVENT_TOUCHCANCEL:
-        touchDown = false;
-        break;
+        drawingIndexed = !drawingIndexed;
+        glUniform1i(indexedUniform, drawingIndexed);
     }
+    glBufferData(GL_ARRAY_BUFFER, count * sizeof(SpriteInstance), instances, GL_STREAM_DRAW);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
 
-    return EM_FALSE;
+    ++renderStats.drawCalls;
+    renderStats.sprites += count;
+    for(const SpriteInstance* s = instances; s < instances + count; ++s)
+    {
+        const float width = std::min(s->x + s->width, (float)GAME_WIDTH) - std::max(s->x, 0.f);
+        const float height = std::min(s->y + s->height, (float)GAME_HEIGHT) - std::max(s->y, 0.f);
+        renderStats.overdraw += std::max(width, 0.f) * std::max(height, 0.f) / (GAME_WIDTH * GAME_HEIGHT);
+    }
 }
 
-void update_title(float /* t */, float /* dt */)
+void flush_sprites()
 {
-    if (touchStarted || is_key_pressed(DOM_PK_ENTER) || is_key_pressed(DOM_PK_SPACE))
-        EnterGame();
+    if (spriteBatch.empty())
+        return;
+    draw_instances(spriteBatchTexture, spriteBatch.data(), spriteBatch.size());
+    spriteBatch.clear();
 }
 
-void UpdateEndSreen(float /* t */, float /* dt */)
+SpriteInstance make_sprite_instance(const Image& img, float x, float y, float r = 1.f, float g = 1.f, float b = 1.f, float a = 1.f)
 {
-    if (touchStarted || is_key_pressed(DOM_PK_ENTER) || is_key_pressed(DOM_PK_SPACE))
-        EnterTitle();
+    auto toByte = [](float c) { return (uint8_t)std::clamp(c * 255.f + 0.5f, 0.f, 255.f); };
+    return {
+        (float)(int)x, (float)(int)y, (float)img.width, (float)img.height,
+        img.u, img.v, img.uvWidth, img.uvHeight,
+        toByte(r), toByte(g), toByte(b), toByte(a)
+    };
 }
 
-void update_game(float t, float dt)
+void draw_sprite_instances(GLuint glTexture, const SpriteInstance* instances, size_t count)
 {
-    auto* player = find_sprite(TAG_PLAYER);
+    if (glTexture != spriteBatchTexture || spriteBatch.size() + count > MAX_SPRITE_BATCH)
+    {
+        flush_sprites();
+        spriteBatchTexture = glTexture;
+    }
+    spriteBatch.insert(spriteBatch.end(), instances, instances + count);
+}
 
-    // slow down (friction)
-    player->vely -= sign(player->vely) * std::min(std::fabsf(player->vely), 0.004f * dt);
+void draw_image(const Image& img, float x, float y, float r = 1.f, float g = 1.f, float b = 1.f, float a = 1.f)
+{
+    SpriteInstance instance = make_sprite_instance(img, x, y, r, g, b, a);
+    draw_sprite_instances(img.glTexture, &instance, 1);
+}
 
-    // increase speed
-    if (is_key_down(DOM_PK_ARROW_UP))
-        player->vely += dt * 0.008f;
-    if (is_key_down(DOM_PK_ARROW_DOWN))
-        player->vely -= dt * 0.008f;
-    if (is_key_down(DOM_PK_ARROW_LEFT) || (touchInput && !touchDown))
-        player->velx -= dt * 0.003f;
-    if (is_key_down(DOM_PK_ARROW_RIGHT) || (touchInput && touchDown))
-        player->velx += dt * 0.001f;
+bool is_on_screen(float x, float y, float width, float height)
+{
+    return x < GAME_WIDTH && x + width > 0.f && y < GAME_HEIGHT && y + height > 0.f;
+}
 
-    // clamp speed
-    player->velx = std::clamp(player->velx, 0.f, 0.55f);
-    player->vely = std::clamp(player->vely, -0.3f, 0.3f);
+// Draws only the part of the image that is on the screen. For the road, of which the screen shows a seventh.
+void draw_image_clipped(const Image& img, float x, float y)
+{
+    SpriteInstance s = make_sprite_instance(img, x, y);
+    const float x0 = std::max(s.x, 0.f), y0 = std::max(s.y, 0.f);
+    const float x1 = std::min(s.x + s.width, (float)GAME_WIDTH), y1 = std::min(s.y + s.height, (float)GAME_HEIGHT);
+    const float uPerPixel = s.uvWidth / s.width, vPerPixel = s.uvHeight / s.height;
+    s.u += (x0 - s.x) * uPerPixel;
+    s.v += (y0 - s.y) * vPerPixel;
+    s.uvWidth = (x1 - x0) * uPerPixel;
+    s.uvHeight = (y1 - y0) * vPerPixel;
+    s.x = x0;
+    s.y = y0;
+    s.width = x1 - x0;
+    s.height = y1 - y0;
+    draw_sprite_instances(img.glTexture, &s, 1);
+}
 
-    // limit Y within the game area
-    player->y = std::clamp(player->y + player->vely * dt, 0.f, float(STREET_HEIGHT));
+enum { FONT_C64 = 0 };
 
-    // Camera trick: the player's X speed moves all games objects to the left.
-    // Also wrap background pictures infinitely
-    for(Object& o : scene)
-    {
-        if (o.tag == TAG_ROAD || o.tag == TAG_ENEMY)
-            o.x -= player->velx * dt;
-        if (o.tag == TAG_ROAD && o.x < -images[IMG_ROAD].width)
-            o.x += 2 * images[IMG_ROAD].width;
-    }
+// Glyphs of one (font, size) pair baked by FontBaker.cpp, uploaded once into the sprite atlas
+struct GlyphAtlas
+{
+    static constexpr int FirstChar = BakedFont::FirstChar;
+    static constexpr int NumChars = BakedFont::LastChar - FirstChar + 1;
 
-    // spawn enemy cars
-    spawnTimer -= 2.f * player->velx * dt;
-    if (spawnTimer < 0.f && scene.size() < 15 + score / 10000)
-    {
-        spawnTimer = random(0.f, std::min(2500.f, 25.f + 22000000.f / score));
-        auto randomCarImg = (ImageId)(IMG_CAR1 + random(0, (int)IMG_NUM_CARS));
-        scene.push_back(
-        {
-            .x = GAME_WIDTH * 1.5f, .y = random(0.f, float(STREET_HEIGHT)),
-            .img =  randomCarImg, .tag = TAG_ENEMY,.mass = 1.f,
-            .velx = random(0.15f, 0.45f), .vely = random(-0.07f, 0.07f)
-        });
-    }
+    int fontId;
+    const BakedFont* font;
+    // indexed directly by the character code, cropped to the glyph's coverage
+    std::array<Image, FirstChar + NumChars> glyphs;
+};
 
-    // move enemies
-    for(size_t i = 0; i < scene.size(); ++i)
-    {
-        auto& obj = scene[i];
-        if (obj.tag != TAG_ENEMY)
-            continue;
-        // move fw
-        obj.x += obj.velx * dt;
-        // move vertically, say within the street
-        obj.y = std::clamp(obj.y + obj.vely * dt, 0.f, float(STREET_HEIGHT));
-        // mirror Y speed if car collides to curb
-        if ((obj.y <= 0 && obj.vely < 0) || (obj.y >= STREET_HEIGHT && obj.vely > 0))
-            obj.vely = -obj.vely;
-        // remove cars that go out of the screen
-        if (std::fabs(obj.x) > 2 * GAME_WIDTH)
-            remove_sprite_at_index(i--);
-    }
+std::vector<GlyphAtlas> glyphAtlases;
 
-    bool player_collided = false;
-    for (size_t i = 1; i < scene.size(); ++i)
-    {
-        if (scene[i].tag != TAG_ENEMY && scene[i].tag != TAG_PLAYER)
-            continue;
+// Returns an index to glyphAtlases, or -1 if the font hasn't been baked at that size.
+int find_glyph_atlas(int fontId, int size)
+{
+    for(size_t i = 0; i < glyphAtlases.size(); ++i)
+        if (glyphAtlases[i].fontId == fontId && glyphAtlases[i].font->size == size)
+            return i;
+    return -1;
+}
 
-        for (size_t j = 0; j < i; ++j)
+// Uploads the glyphs of the baked fonts into the atlas, their coverage as the white of the palette's ramp.
+void upload_baked_fonts()
+{
+    std::vector<uint8_t> indices;
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    for(const BakedFont& font : c64Fonts)
+    {
+        GlyphAtlas& atlas = glyphAtlases.emplace_back(GlyphAtlas{ .fontId = FONT_C64, .font = &font });
+        for(int i = 0; i < GlyphAtlas::NumChars; ++i)
         {
-            if (scene[j].tag != TAG_ENEMY && scene[j].tag != TAG_PLAYER)
+            const BakedGlyph& glyph = font.glyphs[i];
+            int x, y;
+            if (glyph.width == 0)
                 continue;
-            Object &a = scene[i], &b = scene[j];
-            float a_cx, a_cy, b_cx, b_cy, x_overlap, y_overlap;
-            get_overlap_amount(a, b, x_overlap, y_overlap);
-            if (x_overlap > 0.f && y_overlap > 0.f)
+            if (!allocate_atlas_rect(glyph.width, glyph.height, x, y))
             {
-                // SAT
-                get_center_pos(a, a_cx, a_cy);
-                get_center_pos(b, b_cx, b_cy);
-                float xdir = sign(b_cx - a_cx) * x_overlap * 0.5f;
-                float ydir = sign(b_cy - a_cy) * y_overlap * 0.5f;
-                float xveldiff = 2.f * (b.velx - a.velx) / (a.mass + b.mass);
-                float yveldiff = 2.f * (b.vely - a.vely) / (a.mass + b.mass);
-                if (x_overlap <= y_overlap) // X-suuntainen
-                {
-                    a.x -= xdir;
-                    b.x += xdir; // Erota autot X
-                    if (xdir * xveldiff <= 0.f)
-                    {
-                        a.velx += b.mass * xveldiff;
-                        b.velx -= a.mass * xveldiff;
-                        if (a.tag == TAG_PLAYER || b.tag == TAG_PLAYER)
-                            player_collided = true;
-                    }
-                }
-                else // Y-akselin suuntainen törmäys
-                {
-                    a.y -= ydir;
-                    b.y += ydir; // Erota autot Y
-                    if (ydir * yveldiff <= 0.f)
-                    {
-                        a.vely += b.mass * yveldiff;
-                        b.vely -= a.mass * yveldiff;
-                        if (a.tag == TAG_PLAYER || b.tag == TAG_PLAYER)
-                            player_collided = true;
-                    }
-                }
+                std::printf("Atlas is full, cannot fit font %d size %d\n", FONT_C64, font.size);
+                break;
             }
+            // top row first like the images
+            indices.resize(glyph.width * glyph.height);
+            for(size_t k = 0; k < indices.size(); ++k)
+                indices[k] = coverage_index(font.coverage[glyph.offset + k]);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, glyph.width, glyph.height, GL_RED, GL_UNSIGNED_BYTE, indices.data());
+            Image& image = atlas.glyphs[GlyphAtlas::FirstChar + i];
+            image = { .width = glyph.width, .height = glyph.height };
+            set_atlas_rect(image, x, y);
         }
     }
+}
+
+bool is_text_run_up_to_date(const TextRun& run, const Text& text, float x, float y)
+{
+    return run.x == x && run.y == y && run.r == text.r && run.g == text.g && run.b == text.b && run.a == text.a &&
+        run.fontId == text.fontId && run.fontSize == text.fontSize && run.spacing == text.spacing &&
+        std::strncmp(run.text, text.text, MaxTextLength) == 0;
+}
+
+void build_text_run(TextRun& run, const Text& text, float x, float y, const GlyphAtlas& atlas)
+{
+    std::memcpy(run.text, text.text, MaxTextLength);
+    run.x = x; run.y = y;
+    run.r = text.r; run.g = text.g; run.b = text.b; run.a = text.a;
+    run.fontId = text.fontId; run.fontSize = text.fontSize; run.spacing = text.spacing;
 
-    if (player_collided)
+    run.numInstances = 0;
+    for(const char* str = text.text; *str && str < text.text + MaxTextLength; ++str)
     {
-        play_audio(AUDIO_COLLISION1 + random(0, (int)AUDIO_NUM_COLLISIONS), EM_FALSE);
-        if (t - lastHitTime > 500)
+        unsigned ch = (unsigned char)*str;
+        if (ch < atlas.glyphs.size() && atlas.glyphs[ch].inAtlas)
         {
-            lastHitTime = t;
-            remove_sprite((Tag)(TAG_LIFE1 + --lives));
-            if (lives <= 0)
-            {
-                EnterEndScreen();
-                return;
-            }
+            const BakedGlyph& glyph = atlas.font->glyphs[ch - GlyphAtlas::FirstChar];
+            run.instances[run.numInstances++] = make_sprite_instance(atlas.glyphs[ch], x + glyph.x, y + glyph.y, text.r, text.g, text.b, text.a);
         }
+        x += text.spacing;
     }
+}
 
-    // päivitä pelaajan pisteet ja piste-ennätys
-    score += player->velx * dt;
-    highscore = std::max(score, highscore);
+// Returns false if the font hasn't been baked at the text's size
+bool draw_text(Text& text, float x, float y)
+{
+    if (!text.hasRun || !is_text_run_up_to_date(text.run, text, x, y))
+    {
+        int atlasIndex = find_glyph_atlas(text.fontId, text.fontSize);
+        if (atlasIndex < 0)
+            return false;
+
+        build_text_run(text.run, text, x, y, glyphAtlases[atlasIndex]);
+        text.hasRun = true;
+    }
 
-    // kirjoita uusi pistetilanne merkkijonoksi
-    std::snprintf(find_sprite(TAG_SCORE)->text, MaxTextLength, "%06d0", (int)score/10);
+    draw_sprite_instances(atlasTexture, text.run.instances.data(), text.run.numInstances);
+    return true;
+}
 
-    // kirjoita piste-ennätys merkkijonoksi ja vilkuta tekstiä puna-valkoisena jos ennätys on meidän
-    Object *o = find_sprite(TAG_HIGH_SCORE);
-    std::snprintf(o->text, MaxTextLength, "%06d0", (int)highscore/10);
-    o->g = o->b = (highscore == score && fmod(t, 1000.f) < 500.f) ? 0 : 1;
+// A soft round dot that the sparks and the smoke are drawn with, tinted and scaled
+constexpr int PARTICLE_IMAGE_SIZE = 8;
+Image particleImage;
+// filled by draw_particles(), which draws them all at once
+std::vector<SpriteInstance> particleInstances;
 
-    // päivitä peliaika mm:ss -muodossa
-    int gameSeconds = (int)((emscripten_performance_now() - gameStartTime) / 1000.0);
-    std::snprintf(find_sprite(TAG_MINUTES)->text, MaxTextLength, "%02d", gameSeconds / 60);
-    std::snprintf(find_sprite(TAG_SECONDS)->text, MaxTextLength, "%02d", gameSeconds % 60);
+void upload_particle_image()
+{
+    uint8_t indices[PARTICLE_IMAGE_SIZE * PARTICLE_IMAGE_SIZE];
+    for(int y = 0; y < PARTICLE_IMAGE_SIZE; ++y)
+        for(int x = 0; x < PARTICLE_IMAGE_SIZE; ++x)
+        {
+            const float r = PARTICLE_IMAGE_SIZE * 0.5f;
+            const float d = std::hypot(x + 0.5f - r, y + 0.5f - r) / r;
+            indices[y * PARTICLE_IMAGE_SIZE + x] = coverage_index((uint8_t)(255.f * std::clamp(2.f * (1.f - d), 0.f, 1.f)));
+        }
+    int x, y;
+    if (!allocate_atlas_rect(PARTICLE_IMAGE_SIZE, PARTICLE_IMAGE_SIZE, x, y))
+    {
+        std::printf("Atlas is full, cannot fit the particles\n");
+        return;
+    }
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, PARTICLE_IMAGE_SIZE, PARTICLE_IMAGE_SIZE, GL_RED, GL_UNSIGNED_BYTE, indices);
+    particleImage = { .width = PARTICLE_IMAGE_SIZE, .height = PARTICLE_IMAGE_SIZE };
+    set_atlas_rect(particleImage, x, y);
+    particleInstances.resize(MAX_PARTICLES);
 }
 
-Object create_text(float x, float y, Tag tag)
+// All the particles in one instanced draw: the sparks cool from white to red, the smoke grows as it thins out
+void draw_particles(const ParticlePool& p, float alpha)
 {
-    return { .x=x, .y=y, .img=IMG_TEXT, .tag=tag, .r=1.f, .g=1.f, .b=1.f, .a=1.f, .fontId=FONT_C64, .fontSize=20, .spacing=15 };
+    if (p.count == 0 || !particleImage.inAtlas)
+        return;
+    flush_sprites();
+    // the particles are where the latest tick left them, step back to the time of the frame like the cars
+    const float back = (alpha - 1.f) * SIM_TICK_MS;
+    size_t n = 0;
+    for(size_t i = 0; i < p.count; ++i)
+    {
+        const float life = p.life[i];
+        SpriteInstance s{
+            .u = particleImage.u, .v = particleImage.v, .uvWidth = particleImage.uvWidth, .uvHeight = particleImage.uvHeight
+        };
+        if (p.kind[i] == PARTICLE_SPARK)
+        {
+            s.width = s.height = 2.f;
+            s.r = 255;
+            s.g = uint8_t(100.f + 155.f * life);
+            s.b = uint8_t(220.f * life * life);
+            s.a = uint8_t(255.f * std::min(1.f, 2.f * life));
+        }
+        else
+        {
+            s.width = s.height = (float)(int)(4.f + 8.f * (1.f - life));
+            s.r = s.g = s.b = 230; // lighter than the road
+            s.a = uint8_t(140.f * life);
+        }
+        s.x = (float)(int)(p.x[i] + (p.velx[i] - p.scroll) * back - s.width * 0.5f);
+        s.y = (float)(int)(p.y[i] + p.vely[i] * back - s.height * 0.5f);
+        if (!is_on_screen(s.x, s.y, s.width, s.height))
+        {
+            ++renderStats.particlesCulled;
+            continue;
+        }
+        particleInstances[n++] = s;
+    }
+    if (n > 0)
+        draw_instances(particleImage.glTexture, particleInstances.data(), n);
 }
 
-void EnterTitle()
+// Writes value >= 0 zero padded to at least minDigits digits, like "%0*d" but without the formatting
+// machinery. Returns the end of the string.
+char* format_digits(char* out, int value, int minDigits)
 {
-    scene.clear();
-    scene.push_back({ .x=0.f, .y=0.f, .img = IMG_TITLE });
-    currentRoom = update_title;
+    char digits[16];
+    int n = 0;
+    do
+    {
+        digits[n++] = char('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (n < minDigits && n < (int)sizeof(digits))
+        digits[n++] = '0';
+    while (n > 0)
+        *out++ = digits[--n];
+    *out = '\0';
+    return out;
 }
 
-constexpr int TopLeftToBottomLeft(int y) { return GAME_HEIGHT - y; }
+// The HUD layer: the score bar with the life icons and the numbers on it, drawn into hudTexture when the
+// values change and onto the screen as a single sprite
+constexpr int HUD_Y = 314;
+constexpr int HUD_HEIGHT = GAME_HEIGHT - HUD_Y;
 
-void EnterEndScreen()
-{
-    scene.clear();
-    scene.push_back({ .x=0.f, .y=0.f, .img = IMG_ENDSCREEN });
-    scene.push_back(create_text(359, TopLeftToBottomLeft(294) - 13, TAG_SCORE));
-    std::snprintf(find_sprite(TAG_SCORE)->text, MaxTextLength, "%06d0", (int)score/10);
+GLuint hudFramebuffer;
+Image hudImage;
+Hud hudDrawn;
+bool hudLayerComplete; // false if an image or a font size was missing when it was drawn
+enum { HUD_SCORE, HUD_HIGH_SCORE, HUD_MINUTES, HUD_SECONDS, HUD_NUM_TEXTS };
+std::array<Text, HUD_NUM_TEXTS> hudTexts;
 
-    currentRoom = UpdateEndSreen;
+void init_hud_layer()
+{
+    // drawn into, so RGBA rather than indices. Its rows are in GL order.
+    hudTexture = create_texture(GL_RGBA8, GAME_WIDTH, HUD_HEIGHT);
+    hudImage = { .glTexture = hudTexture, .width = GAME_WIDTH, .height = HUD_HEIGHT, .inAtlas = true };
+    glGenFramebuffers(1, &hudFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, hudFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, hudImage.glTexture, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    for(Text& text : hudTexts)
+        text = { .text = {}, .r=1.f, .g=1.f, .b=1.f, .a=1.f, .fontId=FONT_C64, .fontSize=20, .spacing=15 };
 }
 
-void EnterGame()
+// Redraws the layer if what it shows has changed. Call with nothing in the sprite batch.
+void update_hud_layer(const Hud& shown)
 {
-    scene.clear();
-    scene.push_back({ .x=0.f, .y=0.f, .img=IMG_ROAD, .tag=TAG_ROAD });
-    scene.push_back({ .x=4096.f, .y=0.f, .img=IMG_ROAD, .tag=TAG_ROAD });
-    scene.push_back({ .x=100.f, .y=120.f, .img=IMG_BATMAN, .tag=TAG_PLAYER, .mass=0.05f, .velx=0.05f });
-    scene.push_back({ .x=0.f, .y=314.f, .img=IMG_SCOREBAR });
-    scene.push_back({ .x=380.f, .y=330.f, .img=IMG_LIFE, .tag=TAG_LIFE1 });
-    scene.push_back({ .x=440.f, .y=330.f, .img=IMG_LIFE, .tag=TAG_LIFE2 });
-    scene.push_back({ .x=500.f, .y=330.f, .img=IMG_LIFE, .tag=TAG_LIFE3 });
-
-    scene.push_back(create_text(165.f, 364.f, TAG_SCORE));
-    scene.push_back(create_text(165.f, 332.f, TAG_HIGH_SCORE));
-    scene.push_back(create_text(465.f, 364.f, TAG_MINUTES));
-    scene.push_back(create_text(510.f, 364.f, TAG_SECONDS));
-
-    currentRoom = update_game;
+    if (shown == hudDrawn && hudLayerComplete)
+        return;
+    hudDrawn = shown;
 
-    gameStartTime = emscripten_performance_now();
-    lastHitTime = 0.f;
-    lives = 3;
-    spawnTimer = 0.f;
-    score = 0.f;
+    // the scores are in tens, shown with a zero after them
+    for(int i : { HUD_SCORE, HUD_HIGH_SCORE })
+    {
+        char* end = format_digits(hudTexts[i].text, i == HUD_SCORE ? shown.score : shown.highScore, 6);
+        end[0] = '0';
+        end[1] = '\0';
+    }
+    format_digits(hudTexts[HUD_MINUTES].text, shown.minutes, 2);
+    format_digits(hudTexts[HUD_SECONDS].text, shown.seconds, 2);
+    hudTexts[HUD_HIGH_SCORE].g = hudTexts[HUD_HIGH_SCORE].b = shown.highScoreBlink ? 0.f : 1.f;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, hudFramebuffer);
+    glViewport(0, 0, GAME_WIDTH, HUD_HEIGHT);
+    glUniform2f(pixelSizeUniform, 2.f / GAME_WIDTH, 2.f / HUD_HEIGHT);
+    glClearColor(0.f, 0.f, 0.f, 0.f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    const Image& scorebar = images[IMG_SCOREBAR];
+    const Image& life = images[IMG_LIFE];
+    hudLayerComplete = scorebar.inAtlas && life.inAtlas;
+    if (scorebar.inAtlas)
+        draw_image(scorebar, 0.f, 0.f);
+    for(int i = 0; i < shown.lives && life.inAtlas; ++i)
+        draw_image(life, 380.f + 60.f * i, 330.f - HUD_Y);
+    constexpr float textPositions[HUD_NUM_TEXTS][2] = { { 165.f, 364.f }, { 165.f, 332.f }, { 465.f, 364.f }, { 510.f, 364.f } };
+    for(int i = 0; i < HUD_NUM_TEXTS; ++i)
+        hudLayerComplete &= draw_text(hudTexts[i], textPositions[i][0], textPositions[i][1] - HUD_Y);
+    // only the frames that change the HUD redraw it, leave it out of the draw calls of the scene
+    const RenderStats sceneStats = renderStats;
+    flush_sprites();
+    renderStats = sceneStats;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, GAME_WIDTH, GAME_HEIGHT);
+    glUniform2f(pixelSizeUniform, 2.f / GAME_WIDTH, 2.f / GAME_HEIGHT);
 }
 
-int main()
+// Expects the platform to have made a GL context current
+void init_renderer()
 {
-    init_webgl();
-    emscripten_request_animation_frame_loop(&game_tick, nullptr);
+    static const char vertex_shader[] =
+    R"(
+        attribute vec2 pos;
+        // per instance: position and size in pixels, location in the texture and tint colour
+        attribute vec4 rect;
+        attribute vec4 uvRect;
+        attribute vec4 color;
+        varying vec2 uv;
+        varying vec4 tint;
+        uniform vec2 pixelSize;
+        void main()
+        {
+            uv = uvRect.xy + pos * uvRect.zw;
+            tint = color;
+            gl_Position = vec4((rect.xy + pos * rect.zw) * pixelSize - 1.0, 0.0, 1.0);
+        }
+    )";
 
-    // testImage = create_texture();
-    // load_image(testImage, "title.png", &testImageWidth, &testImageHeight);
+    GLuint vs = compile_shader(GL_VERTEX_SHADER, vertex_shader);
 
-    for(size_t i = 0; i < audioUrls.size(); ++i)
-        preload_audio(i, audioUrls[i]);
+    // indexed: spriteTexture holds indices into the 256 colours of palette
+    static const char fragment_shader[] =
+    R"(
+        precision mediump float;
+        uniform sampler2D spriteTexture;
+        uniform sampler2D palette;
+        uniform bool indexed;
+        varying vec2 uv;
+        varying vec4 tint;
+        void main()
+        {
+            vec4 texel = texture2D(spriteTexture, uv);
+            if (indexed)
+                texel = texture2D(palette, vec2((texel.r * 255.0 + 0.5) / 256.0, 0.5));
+            gl_FragColor = tint * texel;
+        }
+    )";
+
+    GLuint fs = compile_shader(GL_FRAGMENT_SHADER, fragment_shader);
+    GLuint program = create_program(vs, fs);
+    pixelSizeUniform = glGetUniformLocation(program, "pixelSize");
+    glUniform2f(pixelSizeUniform, 2.f / GAME_WIDTH, 2.f / GAME_HEIGHT);
+    indexedUniform = glGetUniformLocation(program, "indexed");
+    glUniform1i(indexedUniform, drawingIndexed);
+    glUniform1i(glGetUniformLocation(program, "palette"), 1);
+    // alpha blending. The alpha is blended separately so that what is drawn into the HUD layer stays opaque
+    // where it covers the score bar.
+    glEnable(GL_BLEND);
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    // geom. buffer
+    glGenBuffers(1, &vertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    const float pos[] = { 0, 0, 1, 0, 0, 1, 1, 1 };
+    glBufferData(GL_ARRAY_BUFFER, sizeof(pos), pos, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+    // sprite instances, refilled every frame. Left bound to GL_ARRAY_BUFFER for flush_sprites().
+    spriteBatch.reserve(MAX_SPRITE_BATCH);
+    glGenBuffers(1, &instanceBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    const GLsizei stride = sizeof(SpriteInstance);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(SpriteInstance, x));
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(SpriteInstance, u));
+    glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)offsetof(SpriteInstance, r));
+    for(GLuint attrib = 1; attrib <= 3; ++attrib)
+    {
+        glVertexAttribDivisor(attrib, 1);
+        glEnableVertexAttribArray(attrib);
+    }
+    // the palette on unit 1 for good, the sprite textures are bound to unit 0
+    glActiveTexture(GL_TEXTURE1);
+    paletteTexture = create_texture(GL_RGBA8, PALETTE_SIZE, 1);
+    textureMemory.rgbaSpritesBytes -= PALETTE_SIZE * 4; // the RGBA sprites had no palette
+    init_palette();
+    upload_palette();
+    // sprite atlas, its rows of indices are uploaded tightly packed
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    atlasTexture = create_texture(GL_R8, ATLAS_WIDTH, ATLAS_HEIGHT);
+    upload_baked_fonts();
+    upload_particle_image();
+    init_hud_layer();
+}
+
+// test code: test image
+//GLuint testImage;
+//int testImageWidth, testImageHeight;
+
+// Get center point of a body
+void get_center_pos(const Transform& t, const Physics& p, float &cx, float &cy)
+{
+    cx = t.x + p.width / 2.f;
+    cy = t.y + p.height / 2.f;
+}
+// Laskee kahden spriten X- ja Y-leikkauksen
+void get_overlap_amount(const Transform& a, const Physics& pa, const Transform& b, const Physics& pb, float& x, float& y)
+{
+    x = std::min(a.x + pa.width - b.x, b.x + pb.width - a.x);
+    y = std::min(a.y + pa.height - b.y, b.y + pb.height - a.y);
+}
+
+// Bounces two touching cars off each other along one axis, unless they are already moving apart. dir is the
+// sign of b's center from a's along the axis. Returns true if the velocities were changed and one of the cars is
+// the player.
+bool bounce_cars(size_t ia, size_t ib, bool alongX, float dir)
+{
+    Physics &pa = world.physics[ia], &pb = world.physics[ib];
+    float& va = alongX ? pa.velx : pa.vely;
+    float& vb = alongX ? pb.velx : pb.vely;
+    const float veldiff = 2.f * (vb - va) / (pa.mass + pb.mass);
+    if (dir * veldiff > 0.f)
+        return false;
+    va += pb.mass * veldiff;
+    vb -= pa.mass * veldiff;
+
+    // sparks from the middle of where the cars touch
+    const Transform &a = world.transforms[ia], &b = world.transforms[ib];
+    const float closingSpeed = std::fabs(veldiff) * (pa.mass + pb.mass) * 0.5f;
+    if (alongX)
+        emit_collision_particles(dir > 0.f ? a.x + pa.width : a.x,
+            (std::max(a.y, b.y) + std::min(a.y + pa.height, b.y + pb.height)) * 0.5f, dir, 0.f, closingSpeed);
+    else
+        emit_collision_particles((std::max(a.x, b.x) + std::min(a.x + pa.width, b.x + pb.width)) * 0.5f,
+            dir > 0.f ? a.y + pa.height : a.y, 0.f, dir, closingSpeed);
+    return world.tags[ia] == TAG_PLAYER || world.tags[ib] == TAG_PLAYER;
+}
+
+// Separates two overlapping cars along the axis of least overlap (SAT) and bounces them off each other.
+// Returns true if the velocities were changed and one of the cars is the player.
+bool resolve_collision(size_t ia, size_t ib)
+{
+    Transform &a = world.transforms[ia], &b = world.transforms[ib];
+    Physics &pa = world.physics[ia], &pb = world.physics[ib];
+    float a_cx, a_cy, b_cx, b_cy, x_overlap, y_overlap;
+    get_overlap_amount(a, pa, b, pb, x_overlap, y_overlap);
+    // an earlier pair may have already pushed these apart
+    if (x_overlap <= 0.f || y_overlap <= 0.f)
+        return false;
+
+    get_center_pos(a, pa, a_cx, a_cy);
+    get_center_pos(b, pb, b_cx, b_cy);
+    if (x_overlap <= y_overlap) // X-suuntainen
+    {
+        const float xdir = sign(b_cx - a_cx);
+        a.x -= xdir * x_overlap * 0.5f;
+        b.x += xdir * x_overlap * 0.5f; // Erota autot X
+        return bounce_cars(ia, ib, true, xdir);
+    }
+    else // Y-akselin suuntainen törmäys
+    {
+        const float ydir = sign(b_cy - a_cy);
+        a.y -= ydir * y_overlap * 0.5f;
+        b.y += ydir * y_overlap * 0.5f; // Erota autot Y
+        return bounce_cars(ia, ib, false, ydir);
+    }
+}
+
+// Swept AABB test: when during the tick (0..1) the two cars first touch, moving in a straight line from where
+// they were at the start of the tick to where they are now. Cars that overlapped already at the start touch at
+// 0. Greater than 1 if they don't touch during the tick. alongX: the cars touched side to side, the X overlap
+// began last.
+float time_of_impact(size_t ia, size_t ib, bool& alongX)
+{
+    const Transform &a0 = world.prevTransforms[ia], &a1 = world.transforms[ia];
+    const Transform &b0 = world.prevTransforms[ib], &b1 = world.transforms[ib];
+    const Physics &pa = world.physics[ia], &pb = world.physics[ib];
+    // b moves relative to a by d during the tick, they overlap along an axis while lo < d * t < hi
+    auto overlapTimes = [](float lo, float hi, float d, float& entry, float& exit)
+    {
+        if (d != 0.f)
+        {
+            const float t0 = lo / d, t1 = hi / d;
+            entry = std::min(t0, t1);
+            exit = std::max(t0, t1);
+        }
+        else if (lo < 0.f && hi > 0.f)
+        {
+            entry = -INFINITY;
+            exit = INFINITY;
+        }
+        else
+            entry = exit = INFINITY;
+    };
+    float entryX, exitX, entryY, exitY;
+    overlapTimes(a0.x - pb.width - b0.x, a0.x + pa.width - b0.x, (b1.x - b0.x) - (a1.x - a0.x), entryX, exitX);
+    overlapTimes(a0.y - pb.height - b0.y, a0.y + pa.height - b0.y, (b1.y - b0.y) - (a1.y - a0.y), entryY, exitY);
+    alongX = entryX >= entryY;
+    const float entry = std::max({ entryX, entryY, 0.f });
+    return entry < std::min({ exitX, exitY, 1.f }) ? entry : INFINITY;
+}
+
+// Resolves a pair of cars that touch during the tick. Cars that were overlapping already at the start of the
+// tick are pushed apart by resolve_collision(). Cars that met during the tick are moved back to where they
+// touched and bounced off each other there, along the axis they met on. How deep they would overlap by the end
+// of the tick doesn't matter, so a long tick neither pushes them apart sideways nor lets them pass through each
+// other.
+bool resolve_contact(size_t ia, size_t ib)
+{
+    // an earlier contact may have moved either car
+    bool alongX;
+    const float toi = time_of_impact(ia, ib, alongX);
+    if (toi > 1.f)
+        return false;
+    if (toi <= 0.f)
+        return resolve_collision(ia, ib);
+
+    for(size_t i : { ia, ib })
+    {
+        const Transform& from = world.prevTransforms[i];
+        Transform& to = world.transforms[i];
+        to.x = from.x + (to.x - from.x) * toi;
+        to.y = from.y + (to.y - from.y) * toi;
+    }
+    float a_cx, a_cy, b_cx, b_cy;
+    get_center_pos(world.transforms[ia], world.physics[ia], a_cx, a_cy);
+    get_center_pos(world.transforms[ib], world.physics[ib], b_cx, b_cy);
+    return bounce_cars(ia, ib, alongX, alongX ? sign(b_cx - a_cx) : sign(b_cy - a_cy));
+}
+
+// Sweep and prune broad phase. The cars are kept sorted by their left edge; as the road is only one lane
+// wide, X is the axis that separates them best. The order is carried over from the previous frame, so the
+// insertion sort only has to fix up the few cars that overtook each other.
+struct BroadphaseEntry
+{
+    float minX, maxX, minY, maxY;
+    int index; // entity index
+};
+
+std::vector<BroadphaseEntry> broadphaseEntries, broadphaseNewcomers;
+// entity index pairs whose swept bounding boxes overlap, (higher, lower)
+std::vector<std::pair<int, int>> collisionPairs;
+
+// The pairs of cars that meet during the tick, resolved in the order they touched: time_of_impact() in the high
+// bits, which sort as an integer as it is positive, and the index to collisionPairs in the low bits
+std::vector<uint64_t> contacts;
+// indices to collisionPairs of the cars that were overlapping already at the start of the tick, they go first
+std::vector<int> overlappingPairs;
+
+#ifdef BATCHASE_SIMD
+bool useSimd = true;
+#else
+bool useSimd = false; // the target has no SIMD instructions
+#endif
+bool bruteForcePairs;
+
+#ifdef BATCHASE_SIMD
+// The sorted boxes as separate arrays, padded with boxes that overlap nothing so that the last block of
+// four can be read past the end.
+std::vector<float> broadphaseMinX, broadphaseMinY, broadphaseMaxY;
+
+// Tests each car against the next four cars at a time, in the same order as the scalar loop
+void find_overlapping_pairs_simd()
+{
+    const size_t count = broadphaseEntries.size();
+    broadphaseMinX.assign(count + 3, INFINITY);
+    broadphaseMinY.resize(count + 3);
+    broadphaseMaxY.resize(count + 3);
+    for(size_t i = 0; i < count; ++i)
+    {
+        broadphaseMinX[i] = broadphaseEntries[i].minX;
+        broadphaseMinY[i] = broadphaseEntries[i].minY;
+        broadphaseMaxY[i] = broadphaseEntries[i].maxY;
+    }
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        const BroadphaseEntry& a = broadphaseEntries[i];
+        world.physics[a.index].broadphaseRank = i;
+        const f32x4 aMaxX = f32x4_splat(a.maxX), aMinY = f32x4_splat(a.minY), aMaxY = f32x4_splat(a.maxY);
+        for(size_t j = i + 1; j < count; j += 4)
+        {
+            const m32x4 overlapX = f32x4_lt(f32x4_load(&broadphaseMinX[j]), aMaxX);
+            const m32x4 overlapY = m32x4_and(f32x4_lt(f32x4_load(&broadphaseMinY[j]), aMaxY), f32x4_lt(aMinY, f32x4_load(&broadphaseMaxY[j])));
+            for(int bits = m32x4_bits(m32x4_and(overlapX, overlapY)); bits; bits &= bits - 1)
+                collisionPairs.push_back(std::minmax(a.index, broadphaseEntries[j + std::countr_zero((unsigned)bits)].index, std::greater<int>()));
+            // the cars are sorted by minX, the ones after the first car to the right of a can't overlap it
+            if (m32x4_bits(overlapX) != 0xF)
+                break;
+        }
+    }
+}
+#endif
+
+void reserve_collision_buffers()
+{
+    broadphaseEntries.reserve(MAX_ENTITIES);
+    broadphaseNewcomers.reserve(MAX_ENTITIES);
+    // a car overlaps a few others at most, unless they pile up
+    collisionPairs.reserve(4 * MAX_ENTITIES);
+#ifdef BATCHASE_SIMD
+    broadphaseMinX.reserve(MAX_ENTITIES + 3);
+    broadphaseMinY.reserve(MAX_ENTITIES + 3);
+    broadphaseMaxY.reserve(MAX_ENTITIES + 3);
+#endif
+}
+
+// the box the car has swept during the tick, for the swept test in collide_cars()
+BroadphaseEntry swept_box(size_t i)
+{
+    const Transform& t0 = world.prevTransforms[i];
+    const Transform& t1 = world.transforms[i];
+    const Physics& p = world.physics[i];
+    return { std::min(t0.x, t1.x), std::max(t0.x, t1.x) + p.width, std::min(t0.y, t1.y), std::max(t0.y, t1.y) + p.height, (int)i };
+}
+
+bool is_car(size_t i) { return world.tags[i] == TAG_ENEMY || world.tags[i] == TAG_PLAYER; }
+
+// The O(n^2) reference for the sweep: every pair of cars of the world tested on its own, nothing carried over from
+// the previous tick. The pairs are put in the order the sweep finds them, by the left edges of the left car and
+// of the other one, so that collide_cars() resolves them the same.
+void find_collision_pairs_brute_force()
+{
+    for(size_t i = 0; i < num_entities(); ++i)
+    {
+        if (!is_car(i))
+            continue;
+        const BroadphaseEntry a = swept_box(i);
+        for(size_t j = i + 1; j < num_entities(); ++j)
+        {
+            if (!is_car(j))
+                continue;
+            const BroadphaseEntry b = swept_box(j);
+            if (a.minX < b.maxX && b.minX < a.maxX && a.minY < b.maxY && b.minY < a.maxY)
+                collisionPairs.push_back({ (int)j, (int)i });
+        }
+    }
+    auto order = [](std::pair<int, int> pair)
+    {
+        float left = swept_box(pair.first).minX, right = swept_box(pair.second).minX;
+        if (right < left)
+            std::swap(left, right);
+        return std::pair{ left, right };
+    };
+    std::sort(collisionPairs.begin(), collisionPairs.end(), [&order](auto a, auto b) { return order(a) < order(b); });
+}
+
+void find_collision_pairs()
+{
+    collisionPairs.clear();
+    if (bruteForcePairs)
+    {
+        find_collision_pairs_brute_force();
+        return;
+    }
+
+    // Place the cars in the order they had on the previous frame. Cars that have been removed leave holes,
+    // new cars go to the end and are moved to their place by the insertion sort.
+    const int prevCount = broadphaseEntries.size();
+    broadphaseEntries.assign(prevCount, { .index = -1 });
+    broadphaseNewcomers.clear();
+    for(size_t i = 0; i < num_entities(); ++i)
+    {
+        if (!is_car(i))
+            continue;
+        const BroadphaseEntry e = swept_box(i);
+        const Physics& p = world.physics[i];
+        if (p.broadphaseRank >= 0 && p.broadphaseRank < prevCount && broadphaseEntries[p.broadphaseRank].index < 0)
+            broadphaseEntries[p.broadphaseRank] = e;
+        else
+            broadphaseNewcomers.push_back(e);
+    }
+    std::erase_if(broadphaseEntries, [](const BroadphaseEntry& e) { return e.index < 0; });
+    broadphaseEntries.insert(broadphaseEntries.end(), broadphaseNewcomers.begin(), broadphaseNewcomers.end());
+
+    for(size_t i = 1; i < broadphaseEntries.size(); ++i)
+    {
+        BroadphaseEntry e = broadphaseEntries[i];
+        size_t j = i;
+        for(; j > 0 && broadphaseEntries[j - 1].minX > e.minX; --j)
+            broadphaseEntries[j] = broadphaseEntries[j - 1];
+        broadphaseEntries[j] = e;
+    }
+
+#ifdef BATCHASE_SIMD
+    if (useSimd)
+    {
+        find_overlapping_pairs_simd();
+        return;
+    }
+#endif
+    for(size_t i = 0; i < broadphaseEntries.size(); ++i)
+    {
+        const BroadphaseEntry& a = broadphaseEntries[i];
+        world.physics[a.index].broadphaseRank = i;
+        for(size_t j = i + 1; j < broadphaseEntries.size() && broadphaseEntries[j].minX < a.maxX; ++j)
+        {
+            const BroadphaseEntry& b = broadphaseEntries[j];
+            if (a.minY < b.maxY && b.minY < a.maxY)
+                collisionPairs.push_back(std::minmax(a.index, b.index, std::greater<int>()));
+        }
+    }
+}
+
+float lastHitTime, lastCollisionSoundTime;
+constexpr float MIN_COLLISION_SOUND_INTERVAL = 100.f;
+int lives;
+int playerCollisions;
+bool playerColliding;
+Difficulty difficulty;
+float spawnTimer, score;
+float gameStartTime, highscore = 5000;
+// rush hour: traffic is not limited by the score, toggled on the title screen
+bool rushHour;
+bool godMode;
+constexpr int RUSH_HOUR_MAX_OBJECTS = 400;
+void (*currentRoom)(float t, float dt);
+
+// SIM_TICK_MS: the simulation runs at a fixed rate regardless of the display refresh rate, so that a game
+// plays out the same for the same seed and input. Rendering interpolates between the two latest ticks.
+// don't try to catch up for longer than this, e.g. after the tab has been in the background
+constexpr double MAX_FRAME_MS = 250.0;
+double simTime, simAccumulator;
+// seed of the next game, advanced after every game so that a session replays from its first seed
+uint64_t gameSeed;
+
+Entity player, scoreText;
+constexpr int MAX_LIVES = 3;
+
+// Input events queued by key_event() and touch_event() and applied by the tick they fall in, so that a key
+// tapped between two frames still registers and a press lands on the tick it happened in. One producer (the
+// platform's event handlers) and one consumer (simulate_tick()), so a ring with atomic indices needs no lock.
+// The touch screen is an extra input after the keys.
+constexpr int INPUT_TOUCH = KEY_NUM_KEYS;
+static_assert(INPUT_TOUCH < 32);
+struct InputEvent
+{
+    double t;
+    uint8_t input;
+    bool down;
+};
+constexpr uint32_t MaxInputEvents = 256; // a power of two
+std::array<InputEvent, MaxInputEvents> inputEvents;
+std::atomic<uint32_t> inputEventsRead, inputEventsWritten;
+// the input state as of the current tick: one bit per input, pressed is only set on the tick the input went down
+uint32_t inputDown, inputPressed;
+// time of the event clock at simTime, updated every frame
+double inputClockOffset;
+// set by the first touch event, the player is then steered by touching
+std::atomic<bool> touchInput;
+
+void push_input_event(uint8_t input, bool down, double t)
+{
+    const uint32_t written = inputEventsWritten.load(std::memory_order_relaxed);
+    if (written - inputEventsRead.load(std::memory_order_acquire) == MaxInputEvents)
+        return; // full, the simulation has stalled
+    inputEvents[written % MaxInputEvents] = { t, input, down };
+    inputEventsWritten.store(written + 1, std::memory_order_release);
+}
+
+// Applies the events that happened before the end of the tick
+void apply_input_events(double tickEnd)
+{
+    const uint32_t written = inputEventsWritten.load(std::memory_order_acquire);
+    uint32_t read = inputEventsRead.load(std::memory_order_relaxed);
+    for(; read != written && inputEvents[read % MaxInputEvents].t <= tickEnd; ++read)
+    {
+        const InputEvent& event = inputEvents[read % MaxInputEvents];
+        const uint32_t bit = 1u << event.input;
+        if (event.down)
+        {
+            inputPressed |= bit & ~inputDown;
+            inputDown |= bit;
+        }
+        else
+            inputDown &= ~bit;
+    }
+    inputEventsRead.store(read, std::memory_order_release);
+}
+
+bool is_key_pressed(Key key) { return inputPressed >> key & 1; }
+
+bool is_key_down(Key key) { return inputDown >> key & 1; }
+
+bool is_touch_started() { return inputPressed >> INPUT_TOUCH & 1; }
+
+bool is_touch_down() { return inputDown >> INPUT_TOUCH & 1; }
+
+// profiler overlay, toggled with P in profiler builds. Hiding it writes the profile to stdout (the console on
+// the web) as JSON.
+bool showProfiler;
+
+#ifdef BATCHASE_PROFILER
+std::array<Text, PHASE_NUM_PHASES + 4> profilerLines;
+double profilerLinesTime = -1e9;
+
+// At the end of a frame, so that the counters of the frame are complete, the overlay shows them on the next
+void update_profiler_lines(double t)
+{
+    // refresh a few times a second so that the numbers can be read
+    if (t - profilerLinesTime >= 250.0)
+    {
+        profilerLinesTime = t;
+        for(Text& line : profilerLines)
+            line = { .text = {}, .r=1.f, .g=1.f, .b=0.f, .a=1.f, .fontId=FONT_C64, .fontSize=10, .spacing=8 };
+
+        std::snprintf(profilerLines[0].text, MaxTextLength, "%-10s %6s %6s %6s", "ms", "min", "avg", "p99");
+        for(int i = 0; i < PHASE_NUM_PHASES; ++i)
+        {
+            PhaseStats stats = profiler_phase_stats((ProfilePhase)i);
+            std::snprintf(profilerLines[i + 1].text, MaxTextLength, "%-10s %6.2f %6.2f %6.2f",
+                profiler_phase_name((ProfilePhase)i), stats.minMs, stats.avgMs, stats.p99Ms);
+        }
+
+        // frame intervals as percentages of the frames
+        const uint32_t* histogram = profiler_frame_histogram();
+        uint32_t frames = 0;
+        for(int i = 0; i < PROFILE_HISTOGRAM_BUCKETS; ++i)
+            frames += histogram[i];
+        char* edges = profilerLines[PHASE_NUM_PHASES + 1].text;
+        char* percentages = profilerLines[PHASE_NUM_PHASES + 2].text;
+        int edgesLength = std::snprintf(edges, MaxTextLength, "%-5s", "ms");
+        int percentagesLength = std::snprintf(percentages, MaxTextLength, "%-5s", "%");
+        for(int i = 0; i < PROFILE_HISTOGRAM_BUCKETS; ++i)
+        {
+            if (i + 1 < PROFILE_HISTOGRAM_BUCKETS)
+                edgesLength += std::snprintf(edges + edgesLength, MaxTextLength - edgesLength, "%4g", PROFILE_HISTOGRAM_EDGES_MS[i]);
+            else
+                edgesLength += std::snprintf(edges + edgesLength, MaxTextLength - edgesLength, "%4s", ">");
+            percentagesLength += std::snprintf(percentages + percentagesLength, MaxTextLength - percentagesLength, "%4u",
+                frames ? histogram[i] * 100 / frames : 0);
+        }
+        std::snprintf(profilerLines[PHASE_NUM_PHASES + 3].text, MaxTextLength, "%-10s %6d sprites %d culled %d+%d", "draws",
+            renderStats.drawCalls, renderStats.sprites, renderStats.culled, renderStats.particlesCulled);
+    }
+}
+
+void draw_profiler_overlay()
+{
+    for(size_t i = 0; i < profilerLines.size(); ++i)
+        draw_text(profilerLines[i], 4.f, GAME_HEIGHT - 12.f * (i + 1));
+}
+#endif
+
+// Snapshots of the gameplay state, taken every SNAPSHOT_INTERVAL ticks into a ring of the latest MAX_SNAPSHOTS.
+// Backspace in a game goes back a snapshot at a time, at most to the start of the game, and tools can scrub
+// through a session with restore_game_snapshot(). A snapshot is plain data in arrays of a fixed size, taking or
+// restoring one copies the live entities and nothing is allocated.
+constexpr int SNAPSHOT_INTERVAL = 125; // ticks, a second
+constexpr size_t MAX_SNAPSHOTS = 32;
+
+// A text component without its sprite run, which the renderer rebuilds
+struct SavedText
+{
+    char text[MaxTextLength];
+    float r, g, b, a;
+    int fontId, fontSize, spacing;
+    uint32_t owner;
+};
+
+struct GameSnapshot
+{
+    // the world, the first numEntities, numTexts, numSlots or numFreeSlots elements of the arrays are in use
+    uint32_t numEntities, numTexts, numSlots, numFreeSlots;
+    std::array<Transform, MAX_ENTITIES> transforms;
+    std::array<Physics, MAX_ENTITIES> physics;
+    std::array<Driver, MAX_ENTITIES> drivers;
+    std::array<Sprite, MAX_ENTITIES> sprites;
+    std::array<Tag, MAX_ENTITIES> tags;
+    std::array<uint32_t, MAX_ENTITIES> slots, indices, generations, freeSlots;
+    std::array<SavedText, MAX_TEXTS> texts;
+    uint32_t numBroadphaseEntries; // the broad phase orders the cars by where they were in its previous order
+    Entity player, scoreText;
+    Hud hud;
+    Rng rng;
+    uint64_t gameSeed;
+    void (*room)(float t, float dt);
+    double simTime;
+    float score, highscore, spawnTimer, lastHitTime, lastCollisionSoundTime, gameStartTime;
+    int lives, playerCollisions;
+    bool playerColliding, rushHour;
+    bool gameStart; // taken on the first tick of a game, rewinding stops here
+};
+static_assert(std::is_trivially_copyable_v<GameSnapshot>);
+
+std::array<GameSnapshot, MAX_SNAPSHOTS> gameSnapshots;
+uint64_t gameSnapshotsTaken; // the newest is gameSnapshots[(gameSnapshotsTaken - 1) % MAX_SNAPSHOTS]
+size_t numGameSnapshots;
+int ticksSinceSnapshot;
+bool snapshotIsGameStart;
+
+void update_loading(float t, float dt);
+void update_title(float t, float dt);
+void UpdateEndSreen(float t, float dt);
+void update_game(float t, float dt);
+
+size_t num_game_snapshots() { return numGameSnapshots; }
+
+size_t game_snapshots_memory() { return sizeof(gameSnapshots); }
+
+GameSnapshot& get_game_snapshot(size_t age) { return gameSnapshots[(gameSnapshotsTaken - 1 - age) % MAX_SNAPSHOTS]; }
+
+bool take_game_snapshot()
+{
+    const size_t n = num_entities();
+    // the benchmarks may have more than a game ever has
+    if (n > MAX_ENTITIES || world.generations.size() > MAX_ENTITIES || world.texts.size() > MAX_TEXTS)
+        return false;
+
+    GameSnapshot& s = gameSnapshots[gameSnapshotsTaken % MAX_SNAPSHOTS];
+    ++gameSnapshotsTaken;
+    numGameSnapshots = std::min(numGameSnapshots + 1, MAX_SNAPSHOTS);
+    s.numEntities = n;
+    s.numTexts = world.texts.size();
+    s.numSlots = world.generations.size();
+    s.numFreeSlots = world.freeSlots.size();
+    std::copy_n(world.transforms.begin(), n, s.transforms.begin());
+    std::copy_n(world.physics.begin(), n, s.physics.begin());
+    std::copy_n(world.drivers.begin(), n, s.drivers.begin());
+    std::copy_n(world.sprites.begin(), n, s.sprites.begin());
+    std::copy_n(world.tags.begin(), n, s.tags.begin());
+    std::copy_n(world.slots.begin(), n, s.slots.begin());
+    std::copy_n(world.indices.begin(), s.numSlots, s.indices.begin());
+    std::copy_n(world.generations.begin(), s.numSlots, s.generations.begin());
+    std::copy_n(world.freeSlots.begin(), s.numFreeSlots, s.freeSlots.begin());
+    for(size_t i = 0; i < s.numTexts; ++i)
+    {
+        const Text& text = world.texts[i];
+        SavedText& saved = s.texts[i];
+        std::memcpy(saved.text, text.text, MaxTextLength);
+        saved.r = text.r; saved.g = text.g; saved.b = text.b; saved.a = text.a;
+        saved.fontId = text.fontId; saved.fontSize = text.fontSize; saved.spacing = text.spacing;
+        saved.owner = text.owner;
+    }
+    s.numBroadphaseEntries = broadphaseEntries.size();
+    s.player = player;
+    s.scoreText = scoreText;
+    s.hud = hud;
+    s.rng = rng;
+    s.gameSeed = gameSeed;
+    s.room = currentRoom;
+    s.simTime = simTime;
+    s.score = score;
+    s.highscore = highscore;
+    s.spawnTimer = spawnTimer;
+    s.lastHitTime = lastHitTime;
+    s.lastCollisionSoundTime = lastCollisionSoundTime;
+    s.gameStartTime = gameStartTime;
+    s.lives = lives;
+    s.playerCollisions = playerCollisions;
+    s.playerColliding = playerColliding;
+    s.rushHour = rushHour;
+    s.gameStart = snapshotIsGameStart;
+    snapshotIsGameStart = false;
+    ticksSinceSnapshot = 0;
+    return true;
+}
+
+double restore_game_snapshot(size_t age)
+{
+    const GameSnapshot& s = get_game_snapshot(age);
+    ++sceneVersion;
+    const size_t n = s.numEntities;
+    world.transforms.assign(s.transforms.begin(), s.transforms.begin() + n);
+    // no interpolation from where the cars were before
+    world.prevTransforms = world.transforms;
+    world.physics.assign(s.physics.begin(), s.physics.begin() + n);
+    world.drivers.assign(s.drivers.begin(), s.drivers.begin() + n);
+    world.sprites.assign(s.sprites.begin(), s.sprites.begin() + n);
+    world.tags.assign(s.tags.begin(), s.tags.begin() + n);
+    world.slots.assign(s.slots.begin(), s.slots.begin() + n);
+    world.indices.assign(s.indices.begin(), s.indices.begin() + s.numSlots);
+    world.generations.assign(s.generations.begin(), s.generations.begin() + s.numSlots);
+    world.freeSlots.assign(s.freeSlots.begin(), s.freeSlots.begin() + s.numFreeSlots);
+    world.texts.resize(s.numTexts);
+    for(size_t i = 0; i < s.numTexts; ++i)
+    {
+        const SavedText& saved = s.texts[i];
+        Text& text = world.texts[i];
+        std::memcpy(text.text, saved.text, MaxTextLength);
+        text.r = saved.r; text.g = saved.g; text.b = saved.b; text.a = saved.a;
+        text.fontId = saved.fontId; text.fontSize = saved.fontSize; text.spacing = saved.spacing;
+        text.owner = saved.owner;
+        text.hasRun = false;
+    }
+    broadphaseEntries.resize(s.numBroadphaseEntries);
+    player = s.player;
+    scoreText = s.scoreText;
+    hud = s.hud;
+    rng = s.rng;
+    gameSeed = s.gameSeed;
+    currentRoom = s.room;
+    // the input events keep their clock
+    inputClockOffset += simTime - s.simTime;
+    simTime = s.simTime;
+    score = s.score;
+    highscore = s.highscore;
+    spawnTimer = s.spawnTimer;
+    lastHitTime = s.lastHitTime;
+    lastCollisionSoundTime = s.lastCollisionSoundTime;
+    gameStartTime = s.gameStartTime;
+    lives = s.lives;
+    playerCollisions = s.playerCollisions;
+    playerColliding = s.playerColliding;
+    rushHour = s.rushHour;
+    ticksSinceSnapshot = 0;
+    return simTime;
+}
+
+// Goes back to the previous snapshot, or to the start of the game
+void rewind_game()
+{
+    if (numGameSnapshots == 0)
+        return;
+    // right after a snapshot, or after rewinding to it, go back one more
+    if (ticksSinceSnapshot < SNAPSHOT_INTERVAL / 2 && numGameSnapshots > 1 && !get_game_snapshot(0).gameStart)
+    {
+        --gameSnapshotsTaken;
+        --numGameSnapshots;
+    }
+    restore_game_snapshot(0);
+}
+
+void simulate_tick() { simulate_step(SIM_TICK_MS); }
+
+void simulate_step(float dt)
+{
+    world.prevTransforms = world.transforms;
+    apply_input_events(inputClockOffset + simTime + dt);
+
+#ifdef BATCHASE_PROFILER
+    if (is_key_pressed(KEY_P))
+        showProfiler = !showProfiler;
+#endif
+
+    if (currentRoom == update_game && is_key_pressed(KEY_BACKSPACE))
+        rewind_game();
+
+    if (currentRoom)
+        currentRoom(simTime, dt);
+    simTime += dt;
+    if (currentRoom != update_loading && ++ticksSinceSnapshot >= SNAPSHOT_INTERVAL)
+        take_game_snapshot();
+    inputPressed = 0;
+}
+
+// What the renderer draws: the world itself, or the latest snapshot of it when the simulation runs on its own
+// thread
+struct SceneView
+{
+    const std::vector<Sprite>& sprites;
+    const std::vector<Transform>& prevTransforms;
+    const std::vector<Transform>& transforms;
+    std::vector<Text>& texts; // not const, the texts cache their sprite runs
+    const ParticlePool& particles;
+    const Hud& hud;
+    double time; // of the transforms
+    bool showProfiler;
+};
+
+// alpha: position between the previous and the current tick, [0, 1]
+void draw_scene(const SceneView& view, float alpha)
+{
+    update_atlas();
+
+    renderStats = {};
+    if (view.hud.visible)
+        update_hud_layer(view.hud);
+
+    // Opaque pass: the road or the background picture. They are the first entities of their rooms, so
+    // drawing them first keeps the order, and nothing under them shows through, so blending is off.
+    size_t i = 0;
+    glDisable(GL_BLEND);
+    for(; i < view.sprites.size() && images[view.sprites[i].img].opaque; ++i)
+    {
+        const Transform& prev = view.prevTransforms[i];
+        const Transform& cur = view.transforms[i];
+        const float x = prev.x + (cur.x - prev.x) * alpha;
+        const float y = prev.y + (cur.y - prev.y) * alpha;
+        const auto& img = images[view.sprites[i].img];
+        if (!img.inAtlas)
+            continue;
+        if (is_on_screen(x, y, img.width, img.height))
+            draw_image_clipped(img, x, y);
+        else
+            ++renderStats.culled;
+    }
+    flush_sprites();
+    glEnable(GL_BLEND);
+
+    // blended pass: the cars, the player and the texts
+    for(; i < view.sprites.size(); ++i)
+    {
+        const Sprite& sprite = view.sprites[i];
+        const Transform& prev = view.prevTransforms[i];
+        const Transform& cur = view.transforms[i];
+        const float x = prev.x + (cur.x - prev.x) * alpha;
+        const float y = prev.y + (cur.y - prev.y) * alpha;
+        if (sprite.img == IMG_TEXT)
+        {
+            draw_text(view.texts[sprite.text], x, y);
+        }
+        else
+        {
+            const auto& img = images[sprite.img];
+            if (!img.inAtlas)
+                continue;
+            if (is_on_screen(x, y, img.width, img.height))
+                draw_image(img, x, y);
+            else
+                ++renderStats.culled;
+        }
+    }
+    draw_particles(view.particles, alpha);
+    // over the cars
+    if (view.hud.visible)
+        draw_image(hudImage, 0.f, HUD_Y);
+#ifdef BATCHASE_PROFILER
+    static bool profilerShown;
+    if (view.showProfiler)
+        draw_profiler_overlay();
+    else if (profilerShown)
+        profiler_write_json(stdout);
+    profilerShown = view.showProfiler;
+#endif
+    flush_sprites();
+#ifdef BATCHASE_PROFILER
+    if (view.showProfiler)
+        update_profiler_lines(view.time);
+#endif
+}
+
+void render_scene(float alpha)
+{
+    draw_scene({ world.sprites, world.prevTransforms, world.transforms, world.texts, particles, hud, simTime, showProfiler }, alpha);
+}
+
+// Rooms that only wait for input show the same picture until something happens, so they are drawn once and
+// then only again when the world is replaced (sceneVersion), an image arrives or the platform has lost the
+// picture. The frames in between are skipped, which is what a phone left on the title screen spends its battery on.
+bool is_room_static(void (*room)(float t, float dt)) { return room == update_title || room == UpdateEndSreen; }
+
+uint32_t drawnSceneVersion = ~0u, drawnAtlasVersion;
+bool redrawRequested;
+FrameStats frameStats;
+
+void invalidate_frame() { redrawRequested = true; }
+
+FrameStats frame_stats() { return frameStats; }
+
+// Whether the frame of a scene is drawn, counted either way
+bool should_redraw(bool staticScene, uint32_t version, bool profilerShown)
+{
+    update_atlas();
+    if (staticScene && !profilerShown && !redrawRequested && version == drawnSceneVersion && atlasVersion == drawnAtlasVersion)
+    {
+        ++frameStats.skipped;
+        return false;
+    }
+    drawnSceneVersion = version;
+    drawnAtlasVersion = atlasVersion;
+    redrawRequested = false;
+    ++frameStats.rendered;
+    return true;
+}
+
+void render_frame(float alpha)
+{
+    if (should_redraw(is_room_static(currentRoom), sceneVersion, showProfiler))
+        render_scene(alpha);
+}
+
+#ifdef BATCHASE_SIM_THREAD
+// The simulation thread publishes a snapshot of what to draw after its ticks through a triple buffer: it fills
+// snapshots[backSnapshot] and swaps it with the middle one, the renderer swaps its snapshots[frontSnapshot]
+// with the middle one when that is new. Neither side waits for the other and the renderer always gets the
+// latest complete snapshot.
+struct RenderSnapshot
+{
+    std::vector<Sprite> sprites;
+    std::vector<Transform> prevTransforms, transforms;
+    std::vector<Text> texts;
+    ParticlePool particles;
+    Hud hud;
+    double time; // of the transforms, on the clock of game_frame()
+    double tickMs; // a tick on that clock, 0 when the simulation runs as fast as it can
+    uint64_t tick; // simulated ticks
+    bool showProfiler;
+    uint32_t sceneVersion;
+    bool staticScene;
+};
+
+constexpr uint8_t SNAPSHOT_NEW = 4; // set in middleSnapshot when the simulation has put a new one there
+std::array<RenderSnapshot, 3> snapshots;
+uint8_t backSnapshot = 0, frontSnapshot = 1;
+std::atomic<uint8_t> middleSnapshot{2};
+
+std::thread simThread;
+std::atomic<bool> simThreadRunning;
+std::atomic<uint64_t> simulatedTicks;
+// set by the renderer, the simulation thread must not look at the images while they are being loaded
+std::atomic<bool> requiredAssetsLoaded;
+// bundle_percent_loaded(), copied by the renderer for the loading screen
+std::atomic<int> bundlePercentLoaded{-1};
+
+bool are_required_assets_loaded();
+
+double now_ms()
+{
+#ifdef __EMSCRIPTEN__
+    // the same clock as the requestAnimationFrame and event times, on all threads
+    return emscripten_get_now();
+#else
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void publish_snapshot(double time, double tickMs)
+{
+    RenderSnapshot& snapshot = snapshots[backSnapshot];
+    // assigning reuses the capacity of the vectors, reserved by start_simulation_thread()
+    snapshot.sprites = world.sprites;
+    snapshot.prevTransforms = world.prevTransforms;
+    snapshot.transforms = world.transforms;
+    snapshot.texts.resize(world.texts.size());
+    for(size_t i = 0; i < world.texts.size(); ++i)
+    {
+        // keep the sprite run the renderer has built, it is rebuilt if the text has changed
+        TextRun run = std::move(snapshot.texts[i].run);
+        const bool hasRun = snapshot.texts[i].hasRun;
+        snapshot.texts[i] = world.texts[i];
+        snapshot.texts[i].run = std::move(run);
+        snapshot.texts[i].hasRun = hasRun;
+    }
+    copy_particles(snapshot.particles, particles);
+    snapshot.hud = hud;
+    snapshot.time = time;
+    snapshot.tickMs = tickMs;
+    snapshot.tick = simulatedTicks.load(std::memory_order_relaxed);
+    snapshot.showProfiler = showProfiler;
+    snapshot.sceneVersion = sceneVersion;
+    snapshot.staticScene = is_room_static(currentRoom);
+    backSnapshot = middleSnapshot.exchange(backSnapshot | SNAPSHOT_NEW, std::memory_order_acq_rel) & 3;
+}
+
+// speed: simulated ms per ms, 1 ticks every SIM_TICK_MS like game_frame() does, 0 as fast as possible
+void run_simulation_thread(double speed)
+{
+    double prevT = now_ms();
+    while (simThreadRunning.load(std::memory_order_relaxed))
+    {
+        const double t = now_ms();
+        if (speed > 0.0)
+        {
+            simAccumulator += std::min(MAX_FRAME_MS, (t - prevT) * speed);
+            prevT = t;
+            inputClockOffset = t - simAccumulator - simTime;
+        }
+        else
+            simAccumulator = SIM_TICK_MS;
+
+        {
+            PROFILE_SCOPE(PHASE_SIMULATION);
+            for(; simAccumulator >= SIM_TICK_MS; simAccumulator -= SIM_TICK_MS)
+            {
+                simulate_tick();
+                simulatedTicks.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        // the latest tick is where the game was simAccumulator simulated ms ago
+        if (speed > 0.0)
+            publish_snapshot(t - simAccumulator / speed, SIM_TICK_MS / speed);
+        else
+            publish_snapshot(t, 0.0);
+
+        if (speed > 0.0)
+            std::this_thread::sleep_for(std::chrono::duration<double, std::milli>((SIM_TICK_MS - simAccumulator) / speed));
+    }
+}
+
+void start_simulation_thread(double speed)
+{
+    for(RenderSnapshot& snapshot : snapshots)
+    {
+        snapshot.sprites.reserve(MAX_ENTITIES);
+        snapshot.prevTransforms.reserve(MAX_ENTITIES);
+        snapshot.transforms.reserve(MAX_ENTITIES);
+        snapshot.texts.reserve(MAX_TEXTS);
+    }
+    requiredAssetsLoaded = are_required_assets_loaded();
+    simThreadRunning = true;
+    simThread = std::thread(run_simulation_thread, speed);
+}
+
+void stop_simulation_thread()
+{
+    simThreadRunning = false;
+    simThread.join();
+}
+
+uint64_t num_simulated_ticks() { return simulatedTicks.load(std::memory_order_relaxed); }
+
+uint64_t shown_tick() { return snapshots[frontSnapshot].tick; }
+
+// Draws the latest snapshot from the simulation thread
+void render_snapshot(double t)
+{
+    if (middleSnapshot.load(std::memory_order_relaxed) & SNAPSHOT_NEW)
+        frontSnapshot = middleSnapshot.exchange(frontSnapshot, std::memory_order_acq_rel) & 3;
+    RenderSnapshot& snapshot = snapshots[frontSnapshot];
+    if (should_redraw(snapshot.staticScene, snapshot.sceneVersion, snapshot.showProfiler))
+        draw_scene({ snapshot.sprites, snapshot.prevTransforms, snapshot.transforms, snapshot.texts, snapshot.particles, snapshot.hud, snapshot.time, snapshot.showProfiler },
+            snapshot.tickMs > 0.0 ? std::clamp(float((t - snapshot.time) / snapshot.tickMs), 0.f, 1.f) : 1.f);
+    if (!requiredAssetsLoaded.load(std::memory_order_relaxed) && are_required_assets_loaded())
+        requiredAssetsLoaded.store(true, std::memory_order_release);
+    bundlePercentLoaded.store(bundle_percent_loaded(), std::memory_order_relaxed);
+}
+#endif
+
+bool is_scene_static()
+{
+#ifdef BATCHASE_SIM_THREAD
+    // the room belongs to the simulation thread, ask the snapshot on the screen
+    if (simThread.joinable())
+        return snapshots[frontSnapshot].staticScene && !snapshots[frontSnapshot].showProfiler;
+#endif
+    return is_room_static(currentRoom) && !showProfiler;
+}
+
+void game_frame(double t)
+{
+    // test code: animated colour
+    // glClearColor(0.f, emscripten_math_sin(t/500.0), 0.f, 1.f);
+    // glClear(GL_COLOR_BUFFER_BIT);
+
+    // test code: test image
+    // draw_image(testImage, 0, 0, testImageWidth, testImageHeight);
+
+    static double prevT;
+    const double frameInterval = t - prevT;
+#ifdef BATCHASE_SIM_THREAD
+    if (simThread.joinable())
+    {
+        {
+            PROFILE_SCOPE(PHASE_FRAME);
+            prevT = t;
+            PROFILE_SCOPE(PHASE_RENDER);
+            render_snapshot(t);
+        }
+        PROFILE_END_FRAME(frameInterval);
+        return;
+    }
+#endif
+    {
+        PROFILE_SCOPE(PHASE_FRAME);
+        simAccumulator += std::min(MAX_FRAME_MS, frameInterval);
+        prevT = t;
+        // the ticks below catch the simulation up to t
+        inputClockOffset = t - simAccumulator - simTime;
+
+        {
+            PROFILE_SCOPE(PHASE_SIMULATION);
+            for(; simAccumulator >= SIM_TICK_MS; simAccumulator -= SIM_TICK_MS)
+                simulate_tick();
+        }
+
+        PROFILE_SCOPE(PHASE_RENDER);
+        render_frame(simAccumulator / SIM_TICK_MS);
+    }
+    PROFILE_END_FRAME(frameInterval);
+}
+
+void key_event(Key key, bool down, double t)
+{
+    push_input_event(key, down, t);
+}
+
+void EnterTitle();
+void EnterGame();
+void EnterEndScreen();
+
+Entity loadingText, rushHourText;
+
+// The title waits until the sprites are in, the sounds keep loading in the background
+bool are_required_assets_loaded()
+{
+    for(const auto& img : images)
+        if (img.url && img.width <= 0)
+            return false;
+    return true;
+}
+
+void update_loading(float /* t */, float /* dt */)
+{
+#ifdef BATCHASE_SIM_THREAD
+    const bool threaded = simThreadRunning.load(std::memory_order_relaxed);
+    const bool loaded = threaded ? requiredAssetsLoaded.load(std::memory_order_acquire) : are_required_assets_loaded();
+    const int percent = threaded ? bundlePercentLoaded.load(std::memory_order_relaxed) : bundle_percent_loaded();
+#else
+    const bool loaded = are_required_assets_loaded();
+    const int percent = bundle_percent_loaded();
+#endif
+    if (loaded)
+    {
+        EnterTitle();
+        return;
+    }
+    if (percent >= 0)
+        std::snprintf(get_text(loadingText).text, MaxTextLength, "LOADING %d%%", percent);
+}
+
+void touch_event(TouchEventType type, double t)
+{
+    touchInput = true;
+    // a move keeps the finger down, it doesn't start a touch
+    if (type == TOUCH_MOVE)
+        return;
+    push_input_event(INPUT_TOUCH, type == TOUCH_START, t);
+}
 
-    load_font(FONT_C64, "c64.ttf");
+void set_rush_hour_text()
+{
+    std::snprintf(get_text(rushHourText).text, MaxTextLength, "R: RUSH HOUR %s", rushHour ? "ON" : "OFF");
+}
+
+void update_title(float /* t */, float /* dt */)
+{
+    if (is_key_pressed(KEY_R))
+    {
+        rushHour = !rushHour;
+        set_rush_hour_text();
+        ++sceneVersion;
+    }
+    if (is_touch_started() || is_key_pressed(KEY_ENTER) || is_key_pressed(KEY_SPACE))
+        EnterGame();
+}
+
+void UpdateEndSreen(float /* t */, float /* dt */)
+{
+    if (is_touch_started() || is_key_pressed(KEY_ENTER) || is_key_pressed(KEY_SPACE))
+        EnterTitle();
+}
+
+Physics create_body(ImageId img, float mass, float velx, float vely)
+{
+    return { .velx = velx, .vely = vely, .mass = mass, .width = (float)images[img].width, .height = (float)images[img].height };
+}
+
+void spawn_enemy(float x)
+{
+    auto randomCarImg = (ImageId)(IMG_CAR1 + random(0, (int)IMG_NUM_CARS));
+    float y = lane_y(random(0, NUM_LANES));
+    float velx = random(difficulty.enemyMinVelx, difficulty.enemyMaxVelx);
+    create_entity(randomCarImg, x, y, TAG_ENEMY, create_body(randomCarImg, 1.f, velx, 0.f));
+    world.drivers.back() = { .cruiseVelx = velx, .laneY = y };
+}
+
+void spawn_enemy(const CarState& car)
+{
+    create_entity(IMG_CAR1, car.x, car.y, TAG_ENEMY, create_body(IMG_CAR1, 1.f, car.velx, car.vely));
+}
+
+CarState get_car_state(size_t entity)
+{
+    const Transform& t = world.transforms[entity];
+    const Physics& p = world.physics[entity];
+    return { t.x, t.y, p.velx, p.vely };
+}
 
-    play_audio(AUDIO_BG_MUSIC, EM_TRUE);
+void set_car_state(size_t entity, const CarState& car)
+{
+    Transform& t = world.transforms[entity];
+    Physics& p = world.physics[entity];
+    t.x = car.x;
+    t.y = car.y;
+    p.velx = car.velx;
+    p.vely = car.vely;
+}
 
-    for(auto& img : images)
+// Returns true if the player collided
+bool collide_cars()
+{
+    PROFILE_SCOPE(PHASE_COLLISION);
+    find_collision_pairs();
+    // grow with the pairs, not on a later tick
+    overlappingPairs.reserve(collisionPairs.capacity());
+    contacts.reserve(collisionPairs.capacity());
+    overlappingPairs.clear();
+    contacts.clear();
+    for(size_t n = 0; n < collisionPairs.size(); ++n)
     {
-        img.glTexture = create_texture();
-        if (img.url)
-            load_image(img.glTexture, img.url, &img.width, &img.height);
+        const auto [i, j] = collisionPairs[n];
+        // Most pairs in a jam were touching already at the start of the tick, resolve_collision() left them side by
+        // side. They are pushed apart as they are, like the pairs that overlap.
+        float x_overlap, y_overlap;
+        get_overlap_amount(world.prevTransforms[i], world.physics[i], world.prevTransforms[j], world.physics[j], x_overlap, y_overlap);
+        if (x_overlap >= 0.f && y_overlap >= 0.f)
+        {
+            overlappingPairs.push_back(n);
+            continue;
+        }
+        bool alongX;
+        const float toi = time_of_impact(i, j, alongX);
+        if (toi <= 1.f)
+            contacts.push_back((uint64_t)std::bit_cast<uint32_t>(toi) << 32 | n);
     }
+    // only the few cars that met during the tick need sorting
+    std::sort(contacts.begin(), contacts.end());
 
-    emscripten_set_keydown_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, KeyHandler);
-    emscripten_set_keyup_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, KeyHandler);
+    bool player_collided = false;
+    for(int n : overlappingPairs)
+        player_collided |= resolve_collision(collisionPairs[n].first, collisionPairs[n].second);
+    for(uint64_t contact : contacts)
+    {
+        const auto [i, j] = collisionPairs[(uint32_t)contact];
+        player_collided |= resolve_contact(i, j);
+    }
+    return player_collided;
+}
+
+size_t num_collision_pairs() { return collisionPairs.size(); }
+
+void get_collision_pair(size_t n, int& first, int& second)
+{
+    first = collisionPairs[n].first;
+    second = collisionPairs[n].second;
+}
+
+void move_car(Transform& pos, Physics& body, float dt)
+{
+    // move fw
+    pos.x += body.velx * dt;
+    // move vertically, say within the street
+    pos.y = std::clamp(pos.y + body.vely * dt, 0.f, float(STREET_HEIGHT));
+    // mirror Y speed if car collides to curb
+    if ((pos.y <= 0 && body.vely < 0) || (pos.y >= STREET_HEIGHT && body.vely > 0))
+        body.vely = -body.vely;
+}
+
+bool is_car_off_road(const Transform& pos) { return std::fabs(pos.x) > 2 * GAME_WIDTH; }
+
+#ifdef BATCHASE_SIMD
+// move_car() for four entities at a time, the ones that aren't enemies are left as they were.
+// Returns true if a car went off the road.
+bool move_cars_simd(float dt)
+{
+    static_assert(sizeof(Transform) == 2 * sizeof(float));
+    float* positions = &world.transforms[0].x;
+    const f32x4 dt4 = f32x4_splat(dt), zero = f32x4_splat(0.f), street = f32x4_splat(float(STREET_HEIGHT));
+    const f32x4 roadEnd = f32x4_splat(2 * GAME_WIDTH);
+    bool offRoad = false;
+    size_t i = 0;
+    for(; i + 4 <= num_entities(); i += 4)
+    {
+        const Tag* tags = &world.tags[i];
+        const m32x4 enemy = m32x4_make(tags[0] == TAG_ENEMY, tags[1] == TAG_ENEMY, tags[2] == TAG_ENEMY, tags[3] == TAG_ENEMY);
+        if (!m32x4_bits(enemy))
+            continue;
+
+        const Physics* body = &world.physics[i];
+        const f32x4 velx = f32x4_make(body[0].velx, body[1].velx, body[2].velx, body[3].velx);
+        const f32x4 vely = f32x4_make(body[0].vely, body[1].vely, body[2].vely, body[3].vely);
+        f32x4 x, y;
+        f32x4_deinterleave(f32x4_load(positions + 2 * i), f32x4_load(positions + 2 * i + 4), x, y);
+        x = f32x4_select(enemy, f32x4_add(x, f32x4_mul(velx, dt4)), x);
+        y = f32x4_select(enemy, f32x4_clamp(f32x4_add(y, f32x4_mul(vely, dt4)), zero, street), y);
+        f32x4 xy01, xy23;
+        f32x4_interleave(x, y, xy01, xy23);
+        f32x4_store(positions + 2 * i, xy01);
+        f32x4_store(positions + 2 * i + 4, xy23);
+
+        const m32x4 bounce = m32x4_or(m32x4_and(f32x4_le(y, zero), f32x4_lt(vely, zero)),
+            m32x4_and(f32x4_le(street, y), f32x4_lt(zero, vely)));
+        for(int bits = m32x4_bits(m32x4_and(enemy, bounce)); bits; bits &= bits - 1)
+        {
+            float& carVely = world.physics[i + std::countr_zero((unsigned)bits)].vely;
+            carVely = -carVely;
+        }
+        offRoad |= m32x4_bits(m32x4_and(enemy, f32x4_lt(roadEnd, f32x4_abs(x)))) != 0;
+    }
+    for(; i < num_entities(); ++i)
+    {
+        if (world.tags[i] != TAG_ENEMY)
+            continue;
+        move_car(world.transforms[i], world.physics[i], dt);
+        offRoad |= is_car_off_road(world.transforms[i]);
+    }
+    return offRoad;
+}
+#endif
+
+void move_cars(float dt)
+{
+#ifdef BATCHASE_SIMD
+    if (useSimd)
+    {
+        if (!move_cars_simd(dt))
+            return;
+        // remove cars that go out of the screen, in the same order as below
+        for(size_t i = 0; i < num_entities();)
+        {
+            if (world.tags[i] == TAG_ENEMY && is_car_off_road(world.transforms[i]))
+                remove_entity_at_index(i);
+            else
+                ++i;
+        }
+        return;
+    }
+#endif
+    for(size_t i = 0; i < num_entities();)
+    {
+        if (world.tags[i] != TAG_ENEMY)
+        {
+            ++i;
+            continue;
+        }
+        move_car(world.transforms[i], world.physics[i], dt);
+        // remove cars that go out of the screen, the last entity takes this index
+        if (is_car_off_road(world.transforms[i]))
+            remove_entity_at_index(i);
+        else
+            ++i;
+    }
+}
+
+// Traffic AI: each car keeps to a lane at its cruising speed, brakes behind a slower car ahead and changes to the
+// next lane when that one is free. A car knocked out of its lane by a crash goes back to it, or to the nearest lane
+// that is free. The player is not traffic, the cars don't make way for Batman.
+constexpr float LOOKAHEAD = 100.f; // px in front of a car that its driver watches
+constexpr float FOLLOW_GAP = 15.f; // px a car stops at behind a slower one
+constexpr float FOLLOW_TIME = 400.f; // ms a car takes to close the gap to FOLLOW_GAP
+constexpr float LANE_CHANGE_GAP = 30.f; // px a lane must be free in front of and behind a car
+constexpr float CAR_BRAKE = 0.001f, CAR_ACCELERATION = 0.0002f; // px/ms^2
+constexpr float CAR_MAX_WIDTH = 80.f, CAR_MAX_HEIGHT = 42.f; // of the car images
+
+// The cars around a car come from a uniform grid over the street, rebuilt every tick with a counting sort: a column
+// every TRAFFIC_CELL_WIDTH px between where the cars are removed behind and ahead, and in each column a cell per
+// lane for the cars nearest to it. The cells are contiguous in trafficGridCars column by column, so that the lanes
+// of a column are a single range, and the columns are in the order of x.
+constexpr float TRAFFIC_CELL_WIDTH = 64.f;
+constexpr int TRAFFIC_GRID_COLUMNS = int(4 * GAME_WIDTH / TRAFFIC_CELL_WIDTH) + 1;
+constexpr int TRAFFIC_GRID_CELLS = TRAFFIC_GRID_COLUMNS * NUM_LANES;
+std::array<uint32_t, TRAFFIC_GRID_CELLS + 1> trafficGridStart; // the cars of cell c are [start[c], start[c + 1])
+std::vector<uint32_t> trafficGridCars; // entity indices
+std::vector<uint16_t> trafficCarCells; // of each entity, for the counting sort
+
+void reserve_traffic_grid()
+{
+    trafficGridCars.reserve(MAX_ENTITIES);
+    trafficCarCells.reserve(MAX_ENTITIES);
+}
+
+int traffic_column(float x) { return std::clamp(int((x + 2 * GAME_WIDTH) / TRAFFIC_CELL_WIDTH), 0, TRAFFIC_GRID_COLUMNS - 1); }
+int nearest_lane(float y) { return std::clamp(int(y / LANE_SPACING + 0.5f), 0, NUM_LANES - 1); }
+
+void build_traffic_grid()
+{
+    const size_t n = num_entities();
+    trafficCarCells.resize(n);
+    trafficGridStart.fill(0);
+    size_t cars = 0;
+    for(size_t i = 0; i < n; ++i)
+    {
+        if (world.tags[i] != TAG_ENEMY)
+            continue;
+        const Transform& t = world.transforms[i];
+        trafficCarCells[i] = traffic_column(t.x) * NUM_LANES + nearest_lane(t.y);
+        ++trafficGridStart[trafficCarCells[i]];
+        ++cars;
+    }
+    // the end of each cell, filling the cells from their ends leaves the starts
+    for(int c = 1; c <= TRAFFIC_GRID_CELLS; ++c)
+        trafficGridStart[c] += trafficGridStart[c - 1];
+    trafficGridCars.resize(cars);
+    for(size_t i = n; i-- > 0;)
+        if (world.tags[i] == TAG_ENEMY)
+            trafficGridCars[--trafficGridStart[trafficCarCells[i]]] = i;
+}
+
+// Calls f(j) for the cars from x0 to x1 that may overlap [minY, maxY[, column by column. f returns true when it has
+// found what it was looking for, the columns after that one are skipped.
+template<typename F>
+void for_traffic_near(float minY, float maxY, float x0, float x1, F f)
+{
+    const int lane0 = nearest_lane(minY - CAR_MAX_HEIGHT), lane1 = nearest_lane(maxY);
+    for(int c = traffic_column(x0); c <= traffic_column(x1); ++c)
+    {
+        bool found = false;
+        for(uint32_t k = trafficGridStart[c * NUM_LANES + lane0]; k < trafficGridStart[c * NUM_LANES + lane1 + 1]; ++k)
+            found |= f(trafficGridCars[k]);
+        if (found)
+            return;
+    }
+}
+
+// Returns the nearest car within LOOKAHEAD that car i would run into in [minY, maxY[, or -1
+int find_car_ahead(size_t i, float minY, float maxY, float& gap)
+{
+    const float x = world.transforms[i].x, front = x + world.physics[i].width;
+    int ahead = -1;
+    gap = LOOKAHEAD;
+    for_traffic_near(minY, maxY, x, front + LOOKAHEAD, [&](uint32_t j)
+    {
+        const Transform& t = world.transforms[j];
+        const float g = t.x - front;
+        if (t.x <= x || g >= gap || t.y >= maxY || t.y + world.physics[j].height <= minY)
+            return false;
+        ahead = j;
+        gap = g;
+        return true;
+    });
+    return ahead;
+}
+
+// true if car i fits into the lane at laneY where it is, counting the cars that are changing into the lane
+bool is_lane_free(size_t i, float laneY)
+{
+    const float x = world.transforms[i].x, width = world.physics[i].width, height = world.physics[i].height;
+    bool free = true;
+    for_traffic_near(laneY, laneY + height, x - CAR_MAX_WIDTH - LANE_CHANGE_GAP, x + width + LANE_CHANGE_GAP, [&](uint32_t j)
+    {
+        if (!free)
+            return true;
+        const Transform& t = world.transforms[j];
+        const Physics& p = world.physics[j];
+        const float minY = std::min(t.y, world.drivers[j].laneY), maxY = std::max(t.y, world.drivers[j].laneY) + p.height;
+        free &= j == i || t.x >= x + width + LANE_CHANGE_GAP || t.x + p.width + LANE_CHANGE_GAP <= x || maxY <= laneY || laneY + height <= minY;
+        return !free;
+    });
+    return free;
+}
+
+void update_traffic(float dt)
+{
+    build_traffic_grid();
+    for(uint32_t i : trafficGridCars)
+    {
+        Driver& driver = world.drivers[i];
+        if (driver.cruiseVelx <= 0.f)
+            continue;
+        const float y = world.transforms[i].y, height = world.physics[i].height;
+        Physics& body = world.physics[i];
+        if (std::fabs(y - driver.laneY) >= 1.f && !is_lane_free(i, driver.laneY))
+        {
+            // another car has taken the lane, the nearest free one will do
+            const int lane = nearest_lane(y);
+            for(int other : { lane, lane + 1, lane - 1, lane + 2, lane - 2, lane + 3, lane - 3 })
+                if (other >= 0 && other < NUM_LANES && is_lane_free(i, lane_y(other)))
+                {
+                    driver.laneY = lane_y(other);
+                    break;
+                }
+        }
+
+        // while changing lanes the driver watches both
+        float targetVelx = driver.cruiseVelx, gap;
+        if (const int ahead = find_car_ahead(i, std::min(y, driver.laneY), std::max(y, driver.laneY) + height, gap); ahead >= 0)
+        {
+            const float aheadVelx = world.physics[ahead].velx;
+            // overtake in the next lane, the one towards the middle of the street first
+            if (aheadVelx < driver.cruiseVelx && std::fabs(y - driver.laneY) < 1.f)
+            {
+                const float side = driver.laneY < STREET_HEIGHT / 2 ? LANE_SPACING : -LANE_SPACING;
+                for(float laneY : { driver.laneY + side, driver.laneY - side })
+                    if (laneY >= 0.f && laneY <= STREET_HEIGHT && is_lane_free(i, laneY))
+                    {
+                        driver.laneY = laneY;
+                        break;
+                    }
+            }
+            targetVelx = std::clamp(aheadVelx + (gap - FOLLOW_GAP) / FOLLOW_TIME, 0.f, driver.cruiseVelx);
+        }
+        body.velx += std::clamp(targetVelx - body.velx, -CAR_BRAKE * dt, CAR_ACCELERATION * dt);
+        body.vely = std::clamp((driver.laneY - y) / dt, -difficulty.enemyMaxVely, difficulty.enemyMaxVely);
+    }
+}
+
+void update_hud(float t)
+{
+    hud.visible = true;
+    hud.score = (int)score / 10;
+    // vilkuta piste-ennätystä puna-valkoisena jos ennätys on meidän
+    hud.highScore = (int)highscore / 10;
+    hud.highScoreBlink = highscore == score && std::fmod(t, 1000.f) < 500.f;
+    // peliaika mm:ss -muodossa
+    const int gameSeconds = (int)((t - gameStartTime) / 1000.f);
+    hud.minutes = gameSeconds / 60;
+    hud.seconds = gameSeconds % 60;
+    hud.lives = lives;
+}
+
+void update_game(float t, float dt)
+{
+    const int p = get_index(player);
+    {
+        PROFILE_SCOPE(PHASE_INPUT);
+        Physics& body = world.physics[p];
+
+        // slow down (friction)
+        body.vely -= sign(body.vely) * std::min(std::fabs(body.vely), 0.004f * dt);
+
+        // increase speed
+        if (is_key_down(KEY_UP))
+            body.vely += dt * 0.008f;
+        if (is_key_down(KEY_DOWN))
+            body.vely -= dt * 0.008f;
+        if (is_key_down(KEY_LEFT) || (touchInput && !is_touch_down()))
+            body.velx -= dt * 0.003f;
+        if (is_key_down(KEY_RIGHT) || (touchInput && is_touch_down()))
+            body.velx += dt * 0.001f;
+
+        // clamp speed
+        body.velx = std::clamp(body.velx, 0.f, difficulty.playerMaxVelx);
+        body.vely = std::clamp(body.vely, -0.3f, 0.3f);
+
+        // limit Y within the game area
+        auto& pos = world.transforms[p];
+        pos.y = std::clamp(pos.y + body.vely * dt, 0.f, float(STREET_HEIGHT));
+    }
+    const float playerVelx = world.physics[p].velx;
+
+    {
+        PROFILE_SCOPE(PHASE_TRAFFIC);
+        update_traffic(dt);
+    }
+    {
+        PROFILE_SCOPE(PHASE_MOVEMENT);
+        // Camera trick: the player's X speed moves all games objects to the left.
+        // Also wrap background pictures infinitely
+        for(size_t i = 0; i < num_entities(); ++i)
+        {
+            const Tag tag = world.tags[i];
+            float& x = world.transforms[i].x;
+            if (tag == TAG_ROAD || tag == TAG_ENEMY)
+                x -= playerVelx * dt;
+            if (tag == TAG_ROAD && x < -images[IMG_ROAD].width)
+            {
+                // jump the interpolation too
+                x += 2 * images[IMG_ROAD].width;
+                world.prevTransforms[i].x += 2 * images[IMG_ROAD].width;
+            }
+        }
+
+        // spawn enemy cars
+        spawnTimer -= 2.f * playerVelx * dt;
+        const float maxObjects = rushHour ? RUSH_HOUR_MAX_OBJECTS : difficulty.baseMaxObjects + score / difficulty.scorePerObject;
+        if (spawnTimer < 0.f && num_entities() < std::min(maxObjects, (float)MAX_ENTITIES))
+        {
+            const float maxInterval = rushHour ? difficulty.minSpawnInterval : difficulty.maxSpawnInterval;
+            spawnTimer = random(0.f, std::min(maxInterval, difficulty.minSpawnInterval + difficulty.spawnIntervalScale / score));
+            spawn_enemy(GAME_WIDTH * 1.5f);
+        }
+
+        move_cars(dt);
+    }
+    {
+        PROFILE_SCOPE(PHASE_PARTICLES);
+        update_particles(dt, playerVelx);
+    }
+
+    const bool collided = collide_cars();
+    playerCollisions += collided && !playerColliding;
+    playerColliding = collided;
+    if (collided)
+    {
+        // a collision lasts several ticks, only the first ones start a sound
+        if (t - lastCollisionSoundTime >= MIN_COLLISION_SOUND_INTERVAL)
+        {
+            lastCollisionSoundTime = t;
+            mixer_play(AUDIO_COLLISION1 + random(0, (int)AUDIO_NUM_COLLISIONS), AUDIO_GAIN);
+        }
+        if (t - lastHitTime > 500 && !godMode)
+        {
+            lastHitTime = t;
+            --lives;
+            if (lives <= 0)
+            {
+                EnterEndScreen();
+                return;
+            }
+        }
+    }
+
+    PROFILE_SCOPE(PHASE_TEXT);
+
+    // päivitä pelaajan pisteet ja piste-ennätys
+    score += world.physics[get_index(player)].velx * dt;
+    highscore = std::max(score, highscore);
+
+    update_hud(t);
+}
+
+Entity create_text(float x, float y)
+{
+    Entity e = create_entity(IMG_TEXT, x, y);
+    world.sprites.back().text = world.texts.size();
+    world.texts.push_back({ .text = {}, .r=1.f, .g=1.f, .b=1.f, .a=1.f, .fontId=FONT_C64, .fontSize=20, .spacing=15, .owner=e.slot });
+    return e;
+}
+
+void EnterLoading()
+{
+    clear_world();
+    loadingText = create_text(200.f, 180.f);
+    std::snprintf(get_text(loadingText).text, MaxTextLength, "LOADING");
+    currentRoom = update_loading;
+}
+
+void EnterTitle()
+{
+    clear_world();
+    create_entity(IMG_TITLE, 0.f, 0.f);
+    rushHourText = create_text(10.f, 10.f);
+    set_rush_hour_text();
+    currentRoom = update_title;
+}
+
+constexpr int TopLeftToBottomLeft(int y) { return GAME_HEIGHT - y; }
+
+void EnterEndScreen()
+{
+    clear_world();
+    create_entity(IMG_ENDSCREEN, 0.f, 0.f);
+    scoreText = create_text(359, TopLeftToBottomLeft(294) - 13);
+    std::snprintf(get_text(scoreText).text, MaxTextLength, "%06d0", (int)score/10);
+
+    currentRoom = UpdateEndSreen;
+}
+
+void EnterGame()
+{
+    clear_world();
+    create_entity(IMG_ROAD, 0.f, 0.f, TAG_ROAD);
+    create_entity(IMG_ROAD, 4096.f, 0.f, TAG_ROAD);
+    player = create_entity(IMG_BATMAN, 100.f, 120.f, TAG_PLAYER, create_body(IMG_BATMAN, 0.05f, 0.05f, 0.f));
+    currentRoom = update_game;
+
+    seed_random(gameSeed);
+    splitmix64(gameSeed); // advance to the seed of the next game
+
+    gameStartTime = simTime;
+    lastHitTime = lastCollisionSoundTime = 0.f;
+    lives = MAX_LIVES;
+    playerCollisions = 0;
+    playerColliding = false;
+    spawnTimer = 0.f;
+    score = 0.f;
+    update_hud(simTime);
+    // the start of the game is saved at the end of this tick
+    ticksSinceSnapshot = SNAPSHOT_INTERVAL;
+    snapshotIsGameStart = true;
+}
+
+void init_game()
+{
+    init_renderer();
+    reserve_world();
+    reserve_collision_buffers();
+    reserve_traffic_grid();
+
+    // testImage = create_texture();
+    // load_image(testImage, "title.png", &testImageWidth, &testImageHeight);
+
+    // sounds come from the bundle if it has them
+    load_bundle("BatChase.bundle", &bundleIndex, &bundleProgress);
+
+    for(size_t i = 0; i < audioUrls.size(); ++i)
+        preload_audio(i, audioUrls[i]);
 
-    emscripten_set_resize_callback(EMSCRIPTEN_EVENT_TARGET_WINDOW, nullptr, EM_FALSE, ResizeHandler);
+    mixer_play(AUDIO_BG_MUSIC, AUDIO_GAIN, 1.f, true);
 
-    emscripten_set_touchstart_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, TouchHandler);
-    emscripten_set_touchmove_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, TouchHandler);
-    emscripten_set_touchend_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, TouchHandler);
-    emscripten_set_touchcancel_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, TouchHandler);
+    // natively the bundle and the image files have been decoded already
+    update_atlas();
 
-    EnterTitle();
+    // the platform sets gameSeed before the first game, this only avoids an all-zero generator state
+    seed_random(gameSeed);
+    EnterLoading();
 }
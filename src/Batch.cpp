@@ -0,0 +1,264 @@
+// Plays many games headless on all cores for tuning the difficulty:
+//   build/BatChaseBatch --games 2000 --set enemyMaxVelx=0.4,0.45,0.5 --set playerMaxVelx=0.5,0.55
+// Every combination of the --set values is played with the same seeds, a bot drives until the game is over.
+// The games are handed out one at a time to worker processes, which all start from the same loaded game:
+// the game state is global, so a process per core is what keeps the instances apart.
+#include "Game.h"
+#include "Platform.h"
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Parameter
+{
+    const char* name;
+    float Difficulty::* field;
+};
+
+const Parameter parameters[] = {
+    { "playerMaxVelx", &Difficulty::playerMaxVelx },
+    { "enemyMinVelx", &Difficulty::enemyMinVelx },
+    { "enemyMaxVelx", &Difficulty::enemyMaxVelx },
+    { "enemyMaxVely", &Difficulty::enemyMaxVely },
+    { "baseMaxObjects", &Difficulty::baseMaxObjects },
+    { "scorePerObject", &Difficulty::scorePerObject },
+    { "minSpawnInterval", &Difficulty::minSpawnInterval },
+    { "maxSpawnInterval", &Difficulty::maxSpawnInterval },
+    { "spawnIntervalScale", &Difficulty::spawnIntervalScale },
+};
+
+// the values of one --set
+struct Axis
+{
+    const Parameter* parameter;
+    std::vector<float> values;
+};
+
+enum Policy
+{
+    POLICY_RANDOM, // accelerates and swerves up and down at random, like BatChaseHeadless
+    POLICY_HOLD // accelerates in a straight line
+};
+
+struct GameResult
+{
+    uint32_t ticks;
+    float score;
+    int collisions;
+    bool finished; // false if it hit --max-ticks
+};
+
+// In memory shared with the workers, followed by a GameResult per game
+struct SharedState
+{
+    std::atomic<uint32_t> nextGame;
+};
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+GameResult play(uint64_t seed, Policy policy, uint32_t maxTicks)
+{
+    gameSeed = seed;
+    EnterGame();
+    std::mt19937 bot(seed);
+    GameResult r{};
+    key_event(KEY_RIGHT, true);
+    for(; r.ticks < maxTicks && lives > 0; ++r.ticks)
+    {
+        if (policy == POLICY_RANDOM && r.ticks % 50 == 0)
+        {
+            int steer = bot() % 3;
+            key_event(KEY_UP, steer == 1);
+            key_event(KEY_DOWN, steer == 2);
+        }
+        simulate_tick();
+    }
+    key_event(KEY_RIGHT, false);
+    key_event(KEY_UP, false);
+    key_event(KEY_DOWN, false);
+    simulate_tick();
+    r.score = score;
+    r.collisions = playerCollisions;
+    r.finished = lives <= 0;
+    return r;
+}
+
+float percentile(std::vector<float> values, int p)
+{
+    auto nth = values.begin() + (values.size() - 1) * p / 100;
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+int main(int argc, char** argv)
+{
+    int games = 1000, workers = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t seed = 1;
+    uint32_t maxTicks = 10 * 60 * 1000 / SIM_TICK_MS;
+    Policy policy = POLICY_RANDOM;
+    const char* jsonPath = "batch.json";
+    std::vector<Axis> axes;
+    for(int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--games") && i + 1 < argc)
+            games = std::max(1, std::atoi(argv[++i]));
+        else if (!std::strcmp(argv[i], "--seed") && i + 1 < argc)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--workers") && i + 1 < argc)
+            workers = std::max(1, std::atoi(argv[++i]));
+        else if (!std::strcmp(argv[i], "--max-ticks") && i + 1 < argc)
+            maxTicks = std::strtoul(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--policy") && i + 1 < argc && (!std::strcmp(argv[i + 1], "random") || !std::strcmp(argv[i + 1], "hold")))
+            policy = !std::strcmp(argv[++i], "hold") ? POLICY_HOLD : POLICY_RANDOM;
+        else if (!std::strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--assets") && i + 1 < argc)
+            assetDirectory = argv[++i];
+        else if (!std::strcmp(argv[i], "--set") && i + 1 < argc)
+        {
+            // name=value,value,...
+            const char* arg = argv[++i];
+            const char* equals = std::strchr(arg, '=');
+            auto parameter = std::find_if(std::begin(parameters), std::end(parameters), [&](const Parameter& p)
+                { return equals && std::string(arg, equals) == p.name; });
+            if (parameter == std::end(parameters))
+            {
+                std::fprintf(stderr, "Unknown parameter in %s, one of:", arg);
+                for(const Parameter& p : parameters)
+                    std::fprintf(stderr, " %s", p.name);
+                std::fprintf(stderr, "\n");
+                return 1;
+            }
+            Axis& axis = axes.emplace_back(Axis{ parameter, {} });
+            for(char* s = (char*)equals + 1; *s; s += *s == ',')
+                axis.values.push_back(std::strtof(s, &s));
+        }
+        else
+        {
+            std::printf("usage: %s [--games N] [--seed N] [--workers N] [--max-ticks N] [--policy random|hold]\n"
+                "    [--set PARAMETER=V1,V2,...]... [--json FILE] [--assets DIR]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // every combination of the values, the first --set changing the slowest
+    std::vector<Difficulty> points(1);
+    for(const Axis& axis : axes)
+    {
+        std::vector<Difficulty> expanded;
+        for(const Difficulty& point : points)
+            for(float value : axis.values)
+            {
+                expanded.push_back(point);
+                expanded.back().*axis.parameter->field = value;
+            }
+        points = std::move(expanded);
+    }
+
+    const uint32_t totalGames = points.size() * games;
+    const size_t sharedSize = sizeof(SharedState) + totalGames * sizeof(GameResult);
+    auto* shared = (SharedState*)mmap(nullptr, sharedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED)
+    {
+        std::perror("mmap");
+        return 1;
+    }
+    new (&shared->nextGame) std::atomic<uint32_t>(0);
+    auto* results = (GameResult*)(shared + 1);
+
+    init_game();
+    // leave the loading room, the workers start from here
+    simulate_tick();
+    std::fflush(stdout);
+
+    auto start = std::chrono::steady_clock::now();
+    for(int w = 0; w < workers; ++w)
+    {
+        if (fork() != 0)
+            continue;
+        // the game prints its seed, keep the output for the results
+        std::freopen("/dev/null", "w", stdout);
+        for(uint32_t i; (i = shared->nextGame.fetch_add(1, std::memory_order_relaxed)) < totalGames;)
+        {
+            difficulty = points[i / games];
+            results[i] = play(seed + i % games, policy, maxTicks);
+        }
+        std::_Exit(0);
+    }
+    bool failed = false;
+    for(int status, w = 0; w < workers; ++w)
+        failed |= wait(&status) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (failed)
+    {
+        std::fprintf(stderr, "A worker failed\n");
+        return 1;
+    }
+
+    FILE* json = std::fopen(jsonPath, "w");
+    if (!json)
+    {
+        std::fprintf(stderr, "Cannot write %s\n", jsonPath);
+        return 1;
+    }
+    std::fprintf(json, "{\n  \"games_per_point\": %d,\n  \"seed\": %llu,\n  \"policy\": \"%s\",\n  \"points\": [\n",
+        games, (unsigned long long)seed, policy == POLICY_HOLD ? "hold" : "random");
+
+    for(const Axis& axis : axes)
+        std::printf("%18s ", axis.parameter->name);
+    std::printf("%10s %10s %10s %10s %10s %12s %9s\n", "survival s", "score p10", "score p50", "score p90", "score max", "hits/minute", "unfinished");
+    for(size_t p = 0; p < points.size(); ++p)
+    {
+        std::vector<float> scores;
+        double ticks = 0.0, collisions = 0.0;
+        int unfinished = 0;
+        for(const GameResult* r = results + p * games; r < results + (p + 1) * games; ++r)
+        {
+            scores.push_back(r->score);
+            ticks += r->ticks;
+            collisions += r->collisions;
+            unfinished += !r->finished;
+        }
+        const double survivalSeconds = ticks * SIM_TICK_MS / 1000.0 / games;
+        const double hitsPerMinute = collisions / (ticks * SIM_TICK_MS / 60000.0);
+        const float p10 = percentile(scores, 10), p50 = percentile(scores, 50), p90 = percentile(scores, 90);
+        const float maxScore = *std::max_element(scores.begin(), scores.end());
+
+        for(const Axis& axis : axes)
+            std::printf("%18g ", points[p].*axis.parameter->field);
+        std::printf("%10.1f %10.0f %10.0f %10.0f %10.0f %12.2f %9d\n", survivalSeconds, p10, p50, p90, maxScore, hitsPerMinute, unfinished);
+
+        std::fprintf(json, "    {\n      \"parameters\": {");
+        for(size_t a = 0; a < axes.size(); ++a)
+            std::fprintf(json, "%s\"%s\": %g", a ? ", " : "", axes[a].parameter->name, points[p].*axes[a].parameter->field);
+        std::fprintf(json, "},\n"
+            "      \"survival_seconds\": %.2f,\n"
+            "      \"score_p10\": %.0f,\n"
+            "      \"score_p50\": %.0f,\n"
+            "      \"score_p90\": %.0f,\n"
+            "      \"score_max\": %.0f,\n"
+            "      \"hits_per_minute\": %.3f,\n"
+            "      \"unfinished\": %d\n"
+            "    }%s\n",
+            survivalSeconds, p10, p50, p90, maxScore, hitsPerMinute, unfinished, p + 1 < points.size() ? "," : "");
+    }
+
+    const double gamesPerSecond = totalGames / wallSeconds;
+    std::printf("%u games in %.2f s on %d workers: %.0f games/s, %.1f games/s per worker\n",
+        totalGames, wallSeconds, workers, gamesPerSecond, gamesPerSecond / workers);
+    std::fprintf(json, "  ],\n  \"games\": %u,\n  \"workers\": %d,\n  \"seconds\": %.3f,\n  \"games_per_second_per_worker\": %.2f\n}\n",
+        totalGames, workers, wallSeconds, gamesPerSecond / workers);
+    std::fclose(json);
+}
@@ -0,0 +1,772 @@
+// Benchmarks of the simulation and the render submission, for tracking performance between commits:
+//   build/BatChaseBench --json bench.json
+// A game is played in god mode with the traffic kept at a fixed number of cars. For each car count the
+// benchmark measures the time per tick, the time per car and per candidate pair of the collision pass alone (none
+// when the cars make no pairs), the time per car of
+// the traffic AI alone, heap allocations, and the draw calls and the GL calls per rendered frame as counted by the null GL.
+// Each car count is run with the scalar and the SIMD kernels, which must play out the same game. After the warm-up
+// the ticks and frames must not touch the heap at all.
+// The pairs of cars the sweep-and-prune broad phase finds, and how the collision pass leaves the cars, must be the
+// same as with every pair tested, from a few cars up to more than rush hour's.
+// Two cars crashing head-on must bounce off each other the same way with the 16 ms and 50 ms steps of a slow
+// device, although a 50 ms step takes them past each other.
+// Taking and restoring a snapshot of the game is timed with a game's worth of cars and with rush hour's, the ring
+// of snapshots must fit in the 1.1 MB the README gives it, and a game replayed from a snapshot must end up where it
+// did the first time.
+// The software rasterizer (SoftGL.h) is timed drawing the frames of a game, with the scalar and SIMD row kernels
+// and on one and on all threads, which must all draw the same pixels.
+// The particle pool is kept full at up to its capacity while its update kernel and its draw are timed, against the
+// 1 ms they may take a frame. The scalar and SIMD kernels must move the particles the same, and all of them must
+// go in a single draw call however many there are.
+// The mixer is measured on its own: voice-frames mixed per second, and the largest jump between two samples
+// when voices are stolen, which must stay as small as with no steals at all.
+#include "Game.h"
+#include "NullGL.h"
+#include "Platform.h"
+#include "Mixer.h"
+#include "Particles.h"
+#include "SoftGL.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <thread>
+#include <vector>
+
+static uint64_t allocations;
+
+void* operator new(size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsed_ns(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+struct Result
+{
+    int cars, ticks, frames;
+    bool simd;
+    // for comparing the scalar and SIMD runs
+    float score;
+    size_t entities;
+    double tickNs, pairs, collisionNs, collisionPairs, trafficNs, tickAllocations;
+    double frameNs, frameAllocations, glCalls;
+    double drawCalls, sprites, culled, particlesCulled, overdraw;
+    std::vector<GLCallCounter> glCallsPerFunction;
+};
+
+// A game in god mode with its traffic kept at a fixed number of cars
+struct Traffic
+{
+    int cars;
+    std::mt19937 placement{1};
+    size_t otherEntities; // everything but the enemies: road, player and HUD
+
+    explicit Traffic(int numCars) : cars(numCars)
+    {
+        gameSeed = 1;
+        EnterGame();
+        godMode = true;
+        key_event(KEY_RIGHT, true);
+        otherEntities = num_entities();
+        // fill the whole road, then keep replacing the cars that leave where the game spawns them
+        top_up(-2.f * GAME_WIDTH, 2.f * GAME_WIDTH);
+        for(int i = 0; i < 100; ++i)
+        {
+            top_up();
+            simulate_tick();
+        }
+    }
+
+    void top_up(float minX = 1.5f * GAME_WIDTH, float maxX = 2.f * GAME_WIDTH)
+    {
+        std::uniform_real_distribution<float> x(minX, maxX);
+        while (num_entities() - otherEntities < (size_t)cars)
+            spawn_enemy(x(placement));
+    }
+
+    ~Traffic() { key_event(KEY_RIGHT, false); }
+};
+
+Result run(int cars, bool simd)
+{
+    Result r{ .cars = cars, .simd = simd };
+    useSimd = simd;
+    Traffic traffic(cars);
+    render_scene(0.f);
+
+    r.ticks = std::clamp(400000 / cars, 200, 2000);
+    std::vector<uint64_t> glCallsBefore(MaxGLCallCounters);
+    for(int i = 0; i < numGLCallCounters; ++i)
+        glCallsBefore[i] = glCallCounters[i].count;
+    const uint64_t totalGLCallsBefore = total_gl_calls();
+
+    for(int tick = 0; tick < r.ticks; ++tick)
+    {
+        traffic.top_up();
+
+        uint64_t allocationsBefore = allocations;
+        auto start = Clock::now();
+        simulate_tick();
+        r.tickNs += elapsed_ns(start);
+        r.tickAllocations += allocations - allocationsBefore;
+        r.pairs += num_collision_pairs();
+
+        // a 60 Hz display renders about every other tick
+        if (tick % 2 == 0)
+        {
+            allocationsBefore = allocations;
+            start = Clock::now();
+            render_scene(0.f);
+            r.frameNs += elapsed_ns(start);
+            r.frameAllocations += allocations - allocationsBefore;
+            ++r.frames;
+            const RenderStats stats = last_render_stats();
+            r.drawCalls += stats.drawCalls;
+            r.sprites += stats.sprites;
+            r.culled += stats.culled;
+            r.particlesCulled += stats.particlesCulled;
+            r.overdraw += stats.overdraw;
+        }
+    }
+
+    r.glCalls = double(total_gl_calls() - totalGLCallsBefore) / r.frames;
+    for(int i = 0; i < numGLCallCounters; ++i)
+        if (glCallCounters[i].count > glCallsBefore[i])
+            r.glCallsPerFunction.push_back({ glCallCounters[i].name, glCallCounters[i].count - glCallsBefore[i] });
+
+    r.score = score;
+    r.entities = num_entities();
+
+    // the collision pass on its own, on the world as the last tick left it: each pass is timed on the same cars
+    std::vector<CarState> lastTick(num_entities());
+    for(size_t i = 0; i < lastTick.size(); ++i)
+        lastTick[i] = get_car_state(i);
+    for(int i = 0; i < r.ticks; ++i)
+    {
+        for(size_t j = 0; j < lastTick.size(); ++j)
+            set_car_state(j, lastTick[j]);
+        auto start = Clock::now();
+        collide_cars();
+        r.collisionNs += elapsed_ns(start);
+        r.collisionPairs += num_collision_pairs();
+    }
+    // and the traffic AI
+    for(int i = 0; i < r.ticks; ++i)
+    {
+        auto start = Clock::now();
+        update_traffic(SIM_TICK_MS);
+        r.trafficNs += elapsed_ns(start);
+    }
+    return r;
+}
+
+struct SnapshotResult
+{
+    int cars;
+    double takeNs, restoreNs;
+};
+
+// what the README says the ring of snapshots takes
+constexpr size_t SNAPSHOT_RING_BUDGET = size_t(1.1 * 1048576);
+
+SnapshotResult bench_snapshots(int cars)
+{
+    SnapshotResult r{ .cars = cars };
+    gameSeed = 1;
+    std::mt19937 placement(1);
+    std::uniform_real_distribution<float> x(-2.f * GAME_WIDTH, 2.f * GAME_WIDTH);
+    EnterGame();
+    const size_t otherEntities = num_entities();
+    while (num_entities() - otherEntities < (size_t)cars)
+        spawn_enemy(x(placement));
+    simulate_tick();
+
+    constexpr int repeats = 1000;
+    auto start = Clock::now();
+    for(int i = 0; i < repeats; ++i)
+        take_game_snapshot();
+    r.takeNs = elapsed_ns(start) / repeats;
+    start = Clock::now();
+    for(int i = 0; i < repeats; ++i)
+        restore_game_snapshot(i % num_game_snapshots());
+    r.restoreNs = elapsed_ns(start) / repeats;
+    return r;
+}
+
+uint64_t game_signature()
+{
+    uint64_t signature = std::bit_cast<uint32_t>(score) + ((uint64_t)lives << 32);
+    for(size_t i = 0; i < num_entities(); ++i)
+    {
+        const CarState car = get_car_state(i);
+        for(float f : { car.x, car.y, car.velx, car.vely })
+            signature = signature * 31 + std::bit_cast<uint32_t>(f);
+    }
+    return signature;
+}
+
+// Plays 2000 ticks, goes five snapshots back and plays the same ticks again from there
+bool check_snapshot_replay()
+{
+    gameSeed = 1;
+    EnterGame();
+    godMode = true;
+    // steers by the tick, so that it can pick up at any tick
+    auto play = [](int from, int to)
+    {
+        key_event(KEY_RIGHT, true);
+        for(int tick = from; tick < to; ++tick)
+        {
+            if (tick == from || tick % 50 == 0)
+            {
+                const uint32_t steer = (uint32_t)(tick / 50) * 2654435761u >> 16 & 3;
+                key_event(KEY_UP, steer == 1);
+                key_event(KEY_DOWN, steer == 2);
+            }
+            simulate_tick();
+        }
+        key_event(KEY_RIGHT, false);
+        key_event(KEY_UP, false);
+        key_event(KEY_DOWN, false);
+    };
+    constexpr int ticks = 2000;
+    play(0, ticks);
+    take_game_snapshot();
+    const double end = restore_game_snapshot(0);
+    const uint64_t played = game_signature();
+    const double replayFrom = restore_game_snapshot(5);
+    play(ticks - std::lround((end - replayFrom) / SIM_TICK_MS), ticks);
+    return game_signature() == played;
+}
+
+struct CrashResult
+{
+    CarState left, right;
+};
+
+// Two cars 220 px apart driving into each other at 2 px/ms, in the lane above the player. At 50 ms steps they are
+// 20 px apart after one step and past each other after the next.
+CrashResult crash_cars(float stepMs)
+{
+    gameSeed = 1;
+    EnterGame();
+    godMode = true;
+    const Difficulty tuning = difficulty;
+    difficulty.baseMaxObjects = 0.f; // no other traffic
+    const size_t left = num_entities();
+    spawn_enemy(CarState{ .x = 200.f, .y = 0.f, .velx = 2.f, .vely = 0.f });
+    // the first car is 75 px long
+    spawn_enemy(CarState{ .x = 495.f, .y = 0.f, .velx = -2.f, .vely = 0.f });
+    for(float t = 0.f; t < 400.f; t += stepMs)
+        simulate_step(stepMs);
+    difficulty = tuning;
+    return { get_car_state(left), get_car_state(left + 1) };
+}
+
+struct BroadPhaseResult
+{
+    std::vector<std::pair<int, int>> pairs; // sorted
+    std::vector<CarState> cars;
+};
+
+// The collision pass on cars piled up at random all over the road, after ten ticks of driving and bumping into each
+// other so that the sweep carries its order over, with the sweep or with every pair of the world tested
+BroadPhaseResult collide_pile(int cars, bool bruteForce)
+{
+    gameSeed = 1;
+    EnterGame();
+    godMode = true;
+    const Difficulty tuning = difficulty;
+    difficulty.baseMaxObjects = 0.f; // only the pile
+    std::mt19937 placement(cars);
+    std::uniform_real_distribution<float> x(-2.f * GAME_WIDTH, 2.f * GAME_WIDTH), y(0.f, 160.f), velx(-1.f, 1.f), vely(-0.2f, 0.2f);
+    for(int i = 0; i < cars; ++i)
+        spawn_enemy(CarState{ .x = x(placement), .y = y(placement), .velx = velx(placement), .vely = vely(placement) });
+    for(int tick = 0; tick < 10; ++tick)
+        simulate_tick();
+
+    bruteForcePairs = bruteForce;
+    collide_cars();
+    bruteForcePairs = false;
+    difficulty = tuning;
+
+    BroadPhaseResult r;
+    for(size_t i = 0; i < num_collision_pairs(); ++i)
+    {
+        int first, second;
+        get_collision_pair(i, first, second);
+        r.pairs.push_back({ first, second });
+    }
+    std::sort(r.pairs.begin(), r.pairs.end());
+    for(size_t i = 0; i < num_entities(); ++i)
+        r.cars.push_back(get_car_state(i));
+    return r;
+}
+
+bool same_cars(const std::vector<CarState>& a, const std::vector<CarState>& b)
+{
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const CarState& p, const CarState& q)
+    {
+        return std::bit_cast<uint32_t>(p.x) == std::bit_cast<uint32_t>(q.x) && std::bit_cast<uint32_t>(p.y) == std::bit_cast<uint32_t>(q.y) &&
+            std::bit_cast<uint32_t>(p.velx) == std::bit_cast<uint32_t>(q.velx) && std::bit_cast<uint32_t>(p.vely) == std::bit_cast<uint32_t>(q.vely);
+    });
+}
+
+struct SoftwareRenderResult
+{
+    int cars, threads;
+    bool simd;
+    int frames;
+    double frameNs;
+    uint64_t checksum; // of the pixels of all the frames
+};
+
+SoftwareRenderResult bench_software_render(int cars, int threads, bool simd)
+{
+    SoftwareRenderResult r{ .cars = cars, .threads = threads, .simd = simd, .frames = 1000 };
+    soft_gl_set_threads(threads);
+    softGLUseSimd = simd;
+    softGLRasterize = true;
+    Traffic traffic(cars);
+    for(int frame = 0; frame < r.frames; ++frame)
+    {
+        // a 60 Hz display renders about every other tick
+        for(int tick = 0; tick < 2; ++tick)
+        {
+            traffic.top_up();
+            simulate_tick();
+        }
+        auto start = Clock::now();
+        render_scene(0.5f);
+        r.frameNs += elapsed_ns(start);
+
+        const uint8_t* pixels = soft_gl_pixels();
+        for(size_t i = 0; i < size_t(GAME_WIDTH) * GAME_HEIGHT * 4; i += 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, pixels + i, 8);
+            r.checksum = (r.checksum ^ word) * 0x100000001b3ull;
+        }
+    }
+    softGLRasterize = false;
+    return r;
+}
+
+struct ParticleResult
+{
+    size_t particles;
+    bool simd;
+    int ticks;
+    double updateNs, drawNs, allocations;
+    int drawCalls;
+    uint64_t checksum; // of the pool after the last tick
+};
+
+// what the particles may take of a frame, updating and drawing
+constexpr double PARTICLE_BUDGET_NS = 1e6;
+
+ParticleResult bench_particles(size_t target, bool simd)
+{
+    ParticleResult r{ .particles = target, .simd = simd, .ticks = 500 };
+    particlesUseSimd = simd;
+    gameSeed = 1;
+    EnterGame();
+    std::mt19937 placement(1);
+    std::uniform_real_distribution<float> x(0.f, GAME_WIDTH), y(150.f, GAME_HEIGHT), angle(0.f, 2.f * float(M_PI));
+    for(int tick = 0; tick < r.ticks; ++tick)
+    {
+        // crashes all over the road keep the pool at the target, each throws a couple of dozen particles
+        while (particles.count < target)
+        {
+            const float a = angle(placement);
+            emit_collision_particles(x(placement), y(placement), std::cos(a), std::sin(a), 0.5f);
+        }
+
+        const uint64_t allocationsBefore = allocations;
+        auto start = Clock::now();
+        update_particles(SIM_TICK_MS, 0.3f);
+        r.updateNs += elapsed_ns(start);
+        // a 60 Hz display renders about every other tick
+        if (tick % 2 == 0)
+        {
+            start = Clock::now();
+            render_scene(0.5f);
+            r.drawNs += elapsed_ns(start);
+            r.drawCalls = last_render_stats().drawCalls;
+        }
+        r.allocations += allocations - allocationsBefore;
+    }
+    for(size_t i = 0; i < particles.count; ++i)
+        for(float value : { particles.x[i], particles.y[i], particles.life[i] })
+            r.checksum = (r.checksum ^ std::bit_cast<uint32_t>(value)) * 0x100000001b3ull;
+    // the frames of the scene alone, to leave only what the particles add
+    clear_particles();
+    const int frames = r.ticks / 2;
+    auto start = Clock::now();
+    for(int frame = 0; frame < frames; ++frame)
+        render_scene(0.5f);
+    r.drawNs = std::max(0.0, r.drawNs - elapsed_ns(start)) / frames;
+    r.updateNs /= r.ticks;
+    return r;
+}
+
+struct MixerResult
+{
+    bool simd;
+    double nsPerVoiceFrame, nsPerResampledVoiceFrame;
+    float maxStep, maxStepWithSteals;
+    uint64_t checksum;
+};
+
+// past the game's sounds, which the native backend doesn't load
+constexpr int BENCH_SOUND_STEREO = MIXER_MAX_SOUNDS - 1;
+constexpr int BENCH_SOUND_MONO = MIXER_MAX_SOUNDS - 2;
+constexpr int MIXER_RATE = 48000;
+constexpr int MIXER_BLOCK = 128; // an AudioWorklet render quantum
+
+void load_sine_sounds()
+{
+    for(int channels : { 1, 2 })
+    {
+        int16_t* samples = mixer_load_sound(channels == 1 ? BENCH_SOUND_MONO : BENCH_SOUND_STEREO, channels, MIXER_RATE, MIXER_RATE);
+        for(int i = 0; i < MIXER_RATE; ++i)
+            for(int c = 0; c < channels; ++c)
+                samples[i * channels + c] = int16_t(32767.0 * std::sin(i * 2.0 * M_PI * 440.0 / MIXER_RATE));
+    }
+}
+
+// Largest difference between two consecutive samples of the left channel. All voices loop the same sine, a
+// new one is started every stealInterval frames once they are all playing.
+float max_step(int stealInterval)
+{
+    mixer_init(MIXER_RATE);
+    for(int i = 0; i < MIXER_MAX_VOICES; ++i)
+        mixer_play(BENCH_SOUND_STEREO, 1.f / MIXER_MAX_VOICES, 1.f, true);
+    float left[MIXER_BLOCK], right[MIXER_BLOCK], prev = 0.f, maxStep = 0.f;
+    for(int frame = 0; frame < MIXER_RATE; frame += MIXER_BLOCK)
+    {
+        if (stealInterval > 0 && frame % stealInterval == 0)
+            mixer_play(BENCH_SOUND_STEREO, 1.f / MIXER_MAX_VOICES, 1.f, true);
+        mixer_render(left, right, MIXER_BLOCK);
+        for(float sample : left)
+        {
+            maxStep = std::max(maxStep, std::fabs(sample - prev));
+            prev = sample;
+        }
+    }
+    return maxStep;
+}
+
+MixerResult bench_mixer(bool simd)
+{
+    MixerResult r{ .simd = simd };
+    mixerUseSimd = simd;
+    float left[MIXER_BLOCK], right[MIXER_BLOCK];
+    const int seconds = 10;
+    for(float pitch : { 1.f, 1.01f })
+    {
+        mixer_init(MIXER_RATE);
+        for(int i = 0; i < MIXER_MAX_VOICES; ++i)
+            mixer_play(i % 2 ? BENCH_SOUND_STEREO : BENCH_SOUND_MONO, 1.f / MIXER_MAX_VOICES, pitch, true);
+        auto start = Clock::now();
+        for(int frame = 0; frame < seconds * MIXER_RATE; frame += MIXER_BLOCK)
+        {
+            mixer_render(left, right, MIXER_BLOCK);
+            if (pitch == 1.f)
+                for(int i = 0; i < MIXER_BLOCK; ++i)
+                    r.checksum = r.checksum * 31 + std::bit_cast<uint32_t>(left[i]) + std::bit_cast<uint32_t>(right[i]);
+        }
+        (pitch == 1.f ? r.nsPerVoiceFrame : r.nsPerResampledVoiceFrame) = elapsed_ns(start) / (double(seconds) * MIXER_RATE * MIXER_MAX_VOICES);
+    }
+    r.maxStep = max_step(0);
+    r.maxStepWithSteals = max_step(MIXER_BLOCK * 3);
+    return r;
+}
+
+int main(int argc, char** argv)
+{
+    const char* jsonPath = "bench.json";
+    for(int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--assets") && i + 1 < argc)
+            assetDirectory = argv[++i];
+        else
+        {
+            std::printf("usage: %s [--json FILE] [--assets DIR]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // keeps the textures for the software rasterizer, which draws only in bench_software_render()
+    soft_gl_init(GAME_WIDTH, GAME_HEIGHT);
+    softGLRasterize = false;
+    init_game();
+    const TextureMemory textures = texture_memory();
+    std::printf("texture memory: %.2f MB, %.2f MB with RGBA sprites\n\n", textures.bytes / 1048576.0, textures.rgbaSpritesBytes / 1048576.0);
+
+    // first, the snapshots don't hold the slots of the thousands of cars below
+    std::printf("%6s %14s %14s\n", "cars", "ns/snapshot", "ns/restore");
+    std::vector<SnapshotResult> snapshotResults;
+    for(int cars : { 15, 400 })
+    {
+        const SnapshotResult& r = snapshotResults.emplace_back(bench_snapshots(cars));
+        std::printf("%6d %14.0f %14.0f\n", r.cars, r.takeNs, r.restoreNs);
+    }
+    std::printf("%zu snapshots in %.2f MB\n\n", num_game_snapshots(), game_snapshots_memory() / 1048576.0);
+    const bool snapshotsFit = game_snapshots_memory() <= SNAPSHOT_RING_BUDGET;
+    if (!snapshotsFit)
+        std::fprintf(stderr, "The snapshots take %zu bytes, more than %zu\n", game_snapshots_memory(), SNAPSHOT_RING_BUDGET);
+    const bool replayMatches = check_snapshot_replay();
+    if (!replayMatches)
+        std::fprintf(stderr, "The game replayed from a snapshot ended up different\n");
+
+    // 4 is what the default cap of 15 objects leaves for the cars at the start of a game
+    const int carCounts[] = { 4, 15, 50, 100, 250, 500, 1000, 2000, 5000 };
+    std::vector<Result> results;
+    std::printf("%6s %5s %12s %12s %12s %12s %12s %12s %12s %12s %12s %12s\n", "cars", "simd", "ns/tick", "pairs/tick", "ns/pair", "AI ns/car",
+        "allocs/tick", "ns/frame", "GL/frame", "culled", "p. culled", "overdraw");
+    // useSimd is only on if the kernels have been compiled in
+    const bool simdAvailable = useSimd;
+    bool simdMatches = true, allocationFree = true;
+    for(int cars : carCounts)
+    {
+        for(bool simd : { false, true })
+        {
+            if (simd && !simdAvailable)
+                continue;
+            const Result& r = results.emplace_back(run(cars, simd));
+            const Result& scalar = results[results.size() - 2];
+            if (simd && (r.score != scalar.score || r.entities != scalar.entities || r.pairs != scalar.pairs))
+            {
+                std::fprintf(stderr, "The SIMD kernels played out a different game with %d cars\n", cars);
+                simdMatches = false;
+            }
+            if (r.tickAllocations > 0 || r.frameAllocations > 0)
+            {
+                std::fprintf(stderr, "%.0f heap allocations in the ticks and %.0f in the frames with %d cars\n",
+                    r.tickAllocations, r.frameAllocations, cars);
+                allocationFree = false;
+            }
+            // with no pairs there is nothing to divide the pass by
+            char nsPerPair[16] = "-";
+            if (r.collisionPairs > 0)
+                std::snprintf(nsPerPair, sizeof(nsPerPair), "%.1f", r.collisionNs / r.collisionPairs);
+            std::printf("%6d %5s %12.0f %12.1f %12s %12.1f %12.2f %12.0f %12.1f %12.1f %12.1f %12.2f\n", r.cars, r.simd ? "on" : "off", r.tickNs / r.ticks,
+                r.pairs / r.ticks, nsPerPair, r.trafficNs / r.ticks / r.cars, r.tickAllocations / r.ticks,
+                r.frameNs / r.frames, r.glCalls, r.culled / r.frames, r.particlesCulled / r.frames, r.overdraw / r.frames);
+        }
+    }
+
+    // 400 is rush hour's cap
+    std::printf("\n%6s %5s %12s %12s\n", "cars", "simd", "sweep pairs", "all pairs");
+    bool pairsMatch = true;
+    for(int cars : { 15, 100, 400, 1000 })
+    {
+        for(bool simd : { false, true })
+        {
+            if (simd && !simdAvailable)
+                continue;
+            useSimd = simd;
+            const BroadPhaseResult sweep = collide_pile(cars, false);
+            const BroadPhaseResult all = collide_pile(cars, true);
+            std::printf("%6d %5s %12zu %12zu\n", cars, simd ? "on" : "off", sweep.pairs.size(), all.pairs.size());
+            if (sweep.pairs != all.pairs || !same_cars(sweep.cars, all.cars))
+            {
+                std::fprintf(stderr, "The sweep and testing every pair collided %d cars differently with SIMD %s\n", cars, simd ? "on" : "off");
+                pairsMatch = false;
+            }
+        }
+    }
+    useSimd = simdAvailable;
+
+    std::printf("\n%8s %10s %10s %10s %10s\n", "step ms", "left x", "left velx", "right x", "right velx");
+    bool crashesMatch = true;
+    for(float stepMs : { 16.f, 50.f })
+    {
+        const CrashResult r = crash_cars(stepMs);
+        std::printf("%8g %10.1f %10.2f %10.1f %10.2f\n", stepMs, r.left.x, r.left.velx, r.right.x, r.right.velx);
+        // bounced back the way they came, with their speeds swapped
+        if (r.left.x >= r.right.x || r.left.velx != -2.f || r.right.velx != 2.f)
+        {
+            std::fprintf(stderr, "The crashing cars didn't bounce off each other at %g ms steps\n", stepMs);
+            crashesMatch = false;
+        }
+    }
+
+    // at least two threads, so that the tiles are checked on one core too
+    const int threads = std::max(2u, std::thread::hardware_concurrency());
+    std::vector<SoftwareRenderResult> softwareResults;
+    std::printf("\n%6s %8s %5s %12s %12s\n", "cars", "threads", "simd", "ns/frame", "frames/s");
+    bool softwareMatches = true;
+    for(int cars : { 15, 250 })
+    {
+        const size_t first = softwareResults.size();
+        for(auto [numThreads, simd] : { std::pair{ 1, false }, { 1, true }, { threads, true } })
+        {
+            if (simd && !simdAvailable)
+                continue;
+            const SoftwareRenderResult& r = softwareResults.emplace_back(bench_software_render(cars, numThreads, simd));
+            std::printf("%6d %8d %5s %12.0f %12.0f\n", r.cars, r.threads, r.simd ? "on" : "off", r.frameNs / r.frames, r.frames / r.frameNs * 1e9);
+            if (r.checksum != softwareResults[first].checksum)
+            {
+                std::fprintf(stderr, "The software rasterizer drew different pixels with %d threads and SIMD %s\n", r.threads, r.simd ? "on" : "off");
+                softwareMatches = false;
+            }
+        }
+    }
+    soft_gl_set_threads(1);
+
+    std::vector<ParticleResult> particleResults;
+    std::printf("\n%9s %5s %12s %12s %12s %10s %12s\n", "particles", "simd", "ns/update", "ns/draw", "budget used", "GL draws", "allocations");
+    bool particlesMatch = true, particlesBatched = true, particleAllocationFree = true;
+    for(size_t target : { size_t(1024), size_t(8192), MAX_PARTICLES })
+    {
+        for(bool simd : { false, true })
+        {
+            if (simd && !simdAvailable)
+                continue;
+            const ParticleResult& r = particleResults.emplace_back(bench_particles(target, simd));
+            std::printf("%9zu %5s %12.0f %12.0f %11.1f%% %10d %12.0f\n", r.particles, r.simd ? "on" : "off", r.updateNs, r.drawNs,
+                100.0 * (2.0 * r.updateNs + r.drawNs) / PARTICLE_BUDGET_NS, r.drawCalls, r.allocations);
+            if (simd && r.checksum != particleResults[particleResults.size() - 2].checksum)
+            {
+                std::fprintf(stderr, "The SIMD particle kernel moved %zu particles differently\n", target);
+                particlesMatch = false;
+            }
+            if (r.drawCalls != particleResults[0].drawCalls)
+            {
+                std::fprintf(stderr, "%zu particles took %d draw calls instead of %d\n", target, r.drawCalls, particleResults[0].drawCalls);
+                particlesBatched = false;
+            }
+            if (r.allocations > 0)
+            {
+                std::fprintf(stderr, "%.0f heap allocations with %zu particles\n", r.allocations, target);
+                particleAllocationFree = false;
+            }
+        }
+    }
+    particlesUseSimd = simdAvailable;
+
+    load_sine_sounds();
+    std::vector<MixerResult> mixerResults;
+    std::printf("\n%5s %14s %14s %14s %14s\n", "simd", "ns/voice-frame", "resampled", "max step", "with steals");
+    bool mixerMatches = true, mixerClickFree = true;
+    for(bool simd : { false, true })
+    {
+        if (simd && !simdAvailable)
+            continue;
+        const MixerResult& r = mixerResults.emplace_back(bench_mixer(simd));
+        std::printf("%5s %14.3f %14.3f %14.4f %14.4f\n", r.simd ? "on" : "off", r.nsPerVoiceFrame, r.nsPerResampledVoiceFrame, r.maxStep, r.maxStepWithSteals);
+        if (simd && r.checksum != mixerResults[0].checksum)
+        {
+            std::fprintf(stderr, "The SIMD mixer gives different samples\n");
+            mixerMatches = false;
+        }
+        // a stolen voice fades out while the new one fades in, each moving at most gain / MIXER_RAMP_FRAMES a frame
+        if (r.maxStepWithSteals > r.maxStep + 2.f / MIXER_MAX_VOICES / MIXER_RAMP_FRAMES)
+        {
+            std::fprintf(stderr, "Stealing voices clicks\n");
+            mixerClickFree = false;
+        }
+    }
+
+    FILE* json = std::fopen(jsonPath, "w");
+    if (!json)
+    {
+        std::fprintf(stderr, "Cannot write %s\n", jsonPath);
+        return 1;
+    }
+    std::fprintf(json, "{\n  \"benchmark\": \"BatChase\",\n  \"tick_ms\": %g,\n", SIM_TICK_MS);
+    std::fprintf(json, "  \"texture_bytes\": %zu,\n  \"texture_bytes_with_rgba_sprites\": %zu,\n  \"results\": [\n", textures.bytes, textures.rgbaSpritesBytes);
+    for(size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& r = results[i];
+        char nsPerPair[16] = "null";
+        if (r.collisionPairs > 0)
+            std::snprintf(nsPerPair, sizeof(nsPerPair), "%.2f", r.collisionNs / r.collisionPairs);
+        std::fprintf(json,
+            "    {\n"
+            "      \"cars\": %d,\n"
+            "      \"simd\": %s,\n"
+            "      \"ticks\": %d,\n"
+            "      \"ns_per_tick\": %.1f,\n"
+            "      \"collision_pairs_per_tick\": %.2f,\n"
+            "      \"collision_pass_ns\": %.1f,\n"
+            "      \"collision_pass_ns_per_car\": %.2f,\n"
+            "      \"ns_per_collision_pair\": %s,\n"
+            "      \"traffic_ai_ns_per_car\": %.2f,\n"
+            "      \"allocations_per_tick\": %.3f,\n"
+            "      \"frames\": %d,\n"
+            "      \"ns_per_frame\": %.1f,\n"
+            "      \"allocations_per_frame\": %.3f,\n"
+            "      \"gl_calls_per_frame\": %.2f,\n"
+            "      \"draw_calls_per_frame\": %.2f,\n"
+            "      \"sprites_per_frame\": %.1f,\n"
+            "      \"culled_per_frame\": %.1f,\n"
+            "      \"particles_culled_per_frame\": %.1f,\n"
+            "      \"overdraw\": %.3f,\n"
+            "      \"gl_calls_per_frame_by_function\": {",
+            r.cars, r.simd ? "true" : "false", r.ticks, r.tickNs / r.ticks, r.pairs / r.ticks, r.collisionNs / r.ticks,
+            r.collisionNs / r.ticks / r.cars, nsPerPair, r.trafficNs / r.ticks / r.cars, r.tickAllocations / r.ticks, r.frames,
+            r.frameNs / r.frames, r.frameAllocations / r.frames, r.glCalls, r.drawCalls / r.frames, r.sprites / r.frames, r.culled / r.frames, r.particlesCulled / r.frames, r.overdraw / r.frames);
+        for(size_t j = 0; j < r.glCallsPerFunction.size(); ++j)
+            std::fprintf(json, "%s\"%s\": %.2f", j ? ", " : "", r.glCallsPerFunction[j].name, double(r.glCallsPerFunction[j].count) / r.frames);
+        std::fprintf(json, "}\n    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(json, "  ],\n  \"mixer\": [\n");
+    for(size_t i = 0; i < mixerResults.size(); ++i)
+    {
+        const MixerResult& r = mixerResults[i];
+        std::fprintf(json,
+            "    { \"simd\": %s, \"voices\": %d, \"ns_per_voice_frame\": %.4f, \"ns_per_resampled_voice_frame\": %.4f, "
+            "\"max_step\": %.5f, \"max_step_with_steals\": %.5f }%s\n",
+            r.simd ? "true" : "false", MIXER_MAX_VOICES, r.nsPerVoiceFrame, r.nsPerResampledVoiceFrame, r.maxStep, r.maxStepWithSteals,
+            i + 1 < mixerResults.size() ? "," : "");
+    }
+    std::fprintf(json, "  ],\n  \"snapshot_ring_bytes\": %zu,\n  \"snapshots\": [\n", game_snapshots_memory());
+    for(size_t i = 0; i < snapshotResults.size(); ++i)
+    {
+        const SnapshotResult& r = snapshotResults[i];
+        std::fprintf(json, "    { \"cars\": %d, \"ns_per_snapshot\": %.1f, \"ns_per_restore\": %.1f }%s\n",
+            r.cars, r.takeNs, r.restoreNs, i + 1 < snapshotResults.size() ? "," : "");
+    }
+    std::fprintf(json, "  ],\n  \"software_render\": [\n");
+    for(size_t i = 0; i < softwareResults.size(); ++i)
+    {
+        const SoftwareRenderResult& r = softwareResults[i];
+        std::fprintf(json, "    { \"cars\": %d, \"threads\": %d, \"simd\": %s, \"frames\": %d, \"ns_per_frame\": %.1f, \"frames_per_second\": %.1f }%s\n",
+            r.cars, r.threads, r.simd ? "true" : "false", r.frames, r.frameNs / r.frames, r.frames / r.frameNs * 1e9,
+            i + 1 < softwareResults.size() ? "," : "");
+    }
+    std::fprintf(json, "  ],\n  \"particles\": [\n");
+    for(size_t i = 0; i < particleResults.size(); ++i)
+    {
+        const ParticleResult& r = particleResults[i];
+        std::fprintf(json, "    { \"particles\": %zu, \"simd\": %s, \"ns_per_update\": %.1f, \"ns_per_draw\": %.1f, \"draw_calls\": %d }%s\n",
+            r.particles, r.simd ? "true" : "false", r.updateNs, r.drawNs, r.drawCalls, i + 1 < particleResults.size() ? "," : "");
+    }
+    std::fprintf(json, "  ]\n}\n");
+    std::fclose(json);
+    return simdMatches && allocationFree && pairsMatch && crashesMatch && snapshotsFit && replayMatches && softwareMatches && particlesMatch && particlesBatched &&
+        particleAllocationFree && mixerMatches && mixerClickFree ? 0 : 1;
+}
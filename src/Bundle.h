@@ -0,0 +1,71 @@
+// Asset bundle written by the packer (src/Packer.cpp) and streamed in by the platform backends.
+// Little endian: a BundleHeader, numEntries BundleEntry structs, then the data of the entries in the order
+// they should be loaded in.
+#pragma once
+
+#include <cstdint>
+
+constexpr uint32_t BUNDLE_MAGIC = 0x31434342; // "BCC1"
+constexpr int MaxBundleEntries = 64;
+// the pre-built atlas must fit in the game's atlas texture
+constexpr int BUNDLE_ATLAS_MAX_WIDTH = 4096;
+
+enum BundleEntryType : uint32_t
+{
+    BUNDLE_FILE, // a file from build/ as it is, e.g. an mp3
+    BUNDLE_ATLAS, // palette PNG of the sprites, the rects count the rows from the top
+    BUNDLE_SPRITE, // no data, a rect in the atlas
+    BUNDLE_IMA_ADPCM // 16-bit PCM wav compressed to 4 bits per sample, channels one after another
+};
+
+struct BundleHeader
+{
+    uint32_t magic;
+    uint32_t numEntries;
+};
+
+struct BundleRect
+{
+    uint32_t x, y, width, height;
+};
+
+struct BundleSound
+{
+    uint32_t sampleRate, channels, frames, unused;
+};
+
+struct BundleEntry
+{
+    char name[24]; // file name in build/, as the game asks for it
+    BundleEntryType type;
+    uint32_t offset, size; // of the data from the start of the bundle
+    union
+    {
+        BundleRect sprite; // BUNDLE_ATLAS: size, BUNDLE_SPRITE: rect in the atlas
+        BundleSound adpcm;
+    };
+};
+static_assert(sizeof(BundleEntry) == 52);
+
+struct BundleIndex
+{
+    BundleHeader header;
+    BundleEntry entries[MaxBundleEntries];
+};
+
+enum BundleState : int32_t
+{
+    BUNDLE_LOADING,
+    BUNDLE_INDEX_READY, // index has been filled, entries become ready as they stream in
+    BUNDLE_DONE,
+    BUNDLE_FAILED // no bundle, load the assets from their own files
+};
+
+// Written by the platform as the bundle streams in
+struct BundleProgress
+{
+    uint32_t bytesLoaded, bytesTotal; // bytesTotal is 0 until known
+    BundleState state;
+    // files and sounds have been decoded, atlases can be copied with copy_decoded_image()
+    uint8_t entryReady[MaxBundleEntries];
+};
@@ -0,0 +1,190 @@
+// Bakes the C64 font into a header that is compiled into the game, so that the texts need no font download and no
+// rasterizing at runtime:
+//   build/BatChaseFontBaker --font build/c64.ttf --out src/FontC64.h
+// The glyphs ' ' to '~' are rasterized with FreeType at each size the game draws the font at, into cells laid out
+// like the canvas the web build rasterized them with: size x size pixels with the baseline at the bottom. Each
+// glyph keeps the rectangle of its nonzero coverage as 8-bit rows.
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr int FIRST_CHAR = ' ';
+constexpr int NUM_CHARS = '~' - FIRST_CHAR + 1;
+// the texts and the HUD, the profiler overlay
+constexpr int SIZES[] = { 20, 10 };
+
+struct Glyph
+{
+    int x, y, width, height; // in the cell, y from the top
+    std::vector<uint8_t> coverage;
+};
+
+// Draws the glyphs side by side into one strip like fillText() did, overlapping glyphs blend, then cuts it into cells
+bool bake(FT_Face face, int size, std::vector<Glyph>& glyphs)
+{
+    if (FT_Set_Pixel_Sizes(face, 0, size))
+        return false;
+    const int stripWidth = NUM_CHARS * size;
+    std::vector<uint8_t> strip(size_t(stripWidth) * size);
+    for(int i = 0; i < NUM_CHARS; ++i)
+    {
+        // a symbol font like c64.ttf has its glyphs at U+F020 to U+F0FF, which browsers map the ASCII codes to
+        FT_UInt index = FT_Get_Char_Index(face, FIRST_CHAR + i);
+        if (!index && face->charmap->encoding == FT_ENCODING_MS_SYMBOL)
+            index = FT_Get_Char_Index(face, 0xF000 + FIRST_CHAR + i);
+        if (FT_Load_Glyph(face, index, FT_LOAD_RENDER))
+            return false;
+        const FT_GlyphSlot slot = face->glyph;
+        const FT_Bitmap& bitmap = slot->bitmap;
+        for(int row = 0; row < (int)bitmap.rows; ++row)
+            for(int column = 0; column < (int)bitmap.width; ++column)
+            {
+                const int x = i * size + slot->bitmap_left + column, y = size - slot->bitmap_top + row;
+                if (x < 0 || x >= stripWidth || y < 0 || y >= size)
+                    continue;
+                const int a = bitmap.buffer[row * bitmap.pitch + column];
+                uint8_t& dst = strip[size_t(y) * stripWidth + x];
+                dst = uint8_t(a + (dst * (255 - a) + 127) / 255);
+            }
+    }
+
+    glyphs.assign(NUM_CHARS, {});
+    for(int i = 0; i < NUM_CHARS; ++i)
+    {
+        int x0 = size, y0 = size, x1 = 0, y1 = 0;
+        for(int y = 0; y < size; ++y)
+            for(int x = 0; x < size; ++x)
+                if (strip[size_t(y) * stripWidth + i * size + x])
+                {
+                    x0 = std::min(x0, x);
+                    y0 = std::min(y0, y);
+                    x1 = std::max(x1, x + 1);
+                    y1 = std::max(y1, y + 1);
+                }
+        Glyph& glyph = glyphs[i];
+        if (x0 >= x1)
+            continue;
+        glyph = { x0, y0, x1 - x0, y1 - y0, {} };
+        for(int y = y0; y < y1; ++y)
+            for(int x = x0; x < x1; ++x)
+                glyph.coverage.push_back(strip[size_t(y) * stripWidth + i * size + x]);
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    const char* fontPath = "build/c64.ttf";
+    const char* outPath = "src/FontC64.h";
+    for(int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--font") && i + 1 < argc)
+            fontPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--out") && i + 1 < argc)
+            outPath = argv[++i];
+        else
+        {
+            std::printf("usage: %s [--font FILE] [--out FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) || FT_New_Face(library, fontPath, 0, &face) ||
+        (!face->charmap && FT_Select_Charmap(face, FT_ENCODING_MS_SYMBOL)))
+    {
+        std::fprintf(stderr, "Cannot load %s\n", fontPath);
+        return 1;
+    }
+
+    std::string out =
+        "// Generated by build/BatChaseFontBaker from c64.ttf, see src/FontBaker.cpp. Don't edit.\n"
+        "#pragma once\n"
+        "\n"
+        "#include <cstdint>\n"
+        "\n"
+        "struct BakedGlyph\n"
+        "{\n"
+        "    uint8_t x, y, width, height; // the rectangle of nonzero coverage in the cell, y from the top\n"
+        "    uint16_t offset; // of its rows in the coverage of the font\n"
+        "};\n"
+        "\n"
+        "// The glyphs FirstChar to LastChar in cells of size x size pixels, with the baseline at the bottom\n"
+        "struct BakedFont\n"
+        "{\n"
+        "    static constexpr int FirstChar = ' ';\n"
+        "    static constexpr int LastChar = '~';\n"
+        "    int size;\n"
+        "    const BakedGlyph* glyphs;\n"
+        "    const uint8_t* coverage;\n"
+        "};\n";
+    char line[64];
+    size_t totalBytes = 0;
+    for(int size : SIZES)
+    {
+        std::vector<Glyph> glyphs;
+        if (!bake(face, size, glyphs))
+        {
+            std::fprintf(stderr, "Cannot rasterize %s at %d px\n", fontPath, size);
+            return 1;
+        }
+        const std::string suffix = std::to_string(size);
+        std::string glyphTable = "\nconstexpr BakedGlyph c64Glyphs" + suffix + "[] = {\n";
+        std::string coverage = "\nconstexpr uint8_t c64Coverage" + suffix + "[] = {\n";
+        size_t offset = 0;
+        for(int i = 0; i < NUM_CHARS; ++i)
+        {
+            const Glyph& glyph = glyphs[i];
+            // quoted, a backslash at the end of a comment would continue it on the next line
+            const char ch = char(FIRST_CHAR + i);
+            const std::string name = ch == '\\' ? "'\\\\'" : std::string("'") + ch + "'";
+            std::snprintf(line, sizeof(line), "    { %d, %d, %d, %d, %zu }, // %s\n", glyph.x, glyph.y, glyph.width, glyph.height, offset, name.c_str());
+            glyphTable += line;
+            if (glyph.coverage.empty())
+                continue;
+            coverage += "    // " + name + "\n";
+            for(int y = 0; y < glyph.height; ++y)
+            {
+                coverage += "   ";
+                for(int x = 0; x < glyph.width; ++x)
+                {
+                    std::snprintf(line, sizeof(line), " %3d,", glyph.coverage[y * glyph.width + x]);
+                    coverage += line;
+                }
+                coverage += "\n";
+            }
+            offset += glyph.coverage.size();
+        }
+        if (offset > UINT16_MAX)
+        {
+            std::fprintf(stderr, "The glyphs at %d px don't fit 16-bit offsets\n", size);
+            return 1;
+        }
+        out += glyphTable + "};\n" + coverage + "};\n";
+        totalBytes += offset + NUM_CHARS * 6;
+    }
+    out += "\nconstexpr BakedFont c64Fonts[] = {\n";
+    for(int size : SIZES)
+        out += "    { " + std::to_string(size) + ", c64Glyphs" + std::to_string(size) + ", c64Coverage" + std::to_string(size) + " },\n";
+    out += "};\n";
+
+    // CRLF like the rest of src/
+    std::string crlf;
+    for(char c : out)
+        crlf += c == '\n' ? "\r\n" : std::string(1, c);
+    out = std::move(crlf);
+
+    FILE* file = std::fopen(outPath, "wb");
+    if (!file || std::fwrite(out.data(), 1, out.size(), file) != out.size() || std::fclose(file) != 0)
+    {
+        std::fprintf(stderr, "Cannot write %s\n", outPath);
+        return 1;
+    }
+    std::printf("%s: %zu sizes, %zu bytes of glyphs\n", outPath, std::size(SIZES), totalBytes);
+}
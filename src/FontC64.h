@@ -0,0 +1,2141 @@
+// Generated by build/BatChaseFontBaker from c64.ttf, see src/FontBaker.cpp. Don't edit.
+#pragma once
+
+#include <cstdint>
+
+struct BakedGlyph
+{
+    uint8_t x, y, width, height; // the rectangle of nonzero coverage in the cell, y from the top
+    uint16_t offset; // of its rows in the coverage of the font
+};
+
+// The glyphs FirstChar to LastChar in cells of size x size pixels, with the baseline at the bottom
+struct BakedFont
+{
+    static constexpr int FirstChar = ' ';
+    static constexpr int LastChar = '~';
+    int size;
+    const BakedGlyph* glyphs;
+    const uint8_t* coverage;
+};
+
+constexpr BakedGlyph c64Glyphs20[] = {
+    { 0, 0, 0, 0, 0 }, // ' '
+    { 5, 6, 5, 14, 0 }, // '!'
+    { 1, 6, 13, 5, 70 }, // '"'
+    { 0, 6, 16, 14, 135 }, // '#'
+    { 1, 6, 13, 14, 359 }, // '$'
+    { 1, 6, 13, 14, 541 }, // '%'
+    { 1, 6, 15, 14, 723 }, // '&'
+    { 5, 6, 9, 7, 933 }, // '''
+    { 3, 6, 9, 14, 996 }, // '('
+    { 3, 6, 9, 14, 1122 }, // ')'
+    { 0, 8, 16, 11, 1248 }, // '*'
+    { 1, 8, 13, 11, 1424 }, // '+'
+    { 5, 16, 5, 4, 1567 }, // ','
+    { 1, 12, 13, 3, 1587 }, // '-'
+    { 5, 16, 5, 4, 1626 }, // '.'
+    { 1, 8, 15, 12, 1646 }, // '/'
+    { 1, 6, 13, 14, 1826 }, // '0'
+    { 1, 6, 13, 14, 2008 }, // '1'
+    { 1, 6, 13, 14, 2190 }, // '2'
+    { 1, 6, 13, 14, 2372 }, // '3'
+    { 1, 6, 15, 14, 2554 }, // '4'
+    { 1, 6, 13, 14, 2764 }, // '5'
+    { 1, 6, 13, 14, 2946 }, // '6'
+    { 1, 6, 13, 14, 3128 }, // '7'
+    { 1, 6, 13, 14, 3310 }, // '8'
+    { 1, 6, 13, 14, 3492 }, // '9'
+    { 5, 6, 5, 14, 3674 }, // ':'
+    { 5, 6, 5, 14, 3744 }, // ';'
+    { 1, 6, 13, 14, 3814 }, // '<'
+    { 1, 10, 13, 7, 3996 }, // '='
+    { 1, 6, 13, 14, 4087 }, // '>'
+    { 1, 6, 13, 14, 4269 }, // '?'
+    { 1, 6, 13, 14, 4451 }, // '@'
+    { 1, 6, 13, 14, 4633 }, // 'A'
+    { 1, 6, 13, 14, 4815 }, // 'B'
+    { 1, 6, 13, 14, 4997 }, // 'C'
+    { 1, 6, 13, 14, 5179 }, // 'D'
+    { 1, 6, 13, 14, 5361 }, // 'E'
+    { 1, 6, 13, 14, 5543 }, // 'F'
+    { 1, 6, 13, 14, 5725 }, // 'G'
+    { 1, 6, 13, 14, 5907 }, // 'H'
+    { 3, 6, 9, 14, 6089 }, // 'I'
+    { 1, 6, 13, 14, 6215 }, // 'J'
+    { 1, 6, 13, 14, 6397 }, // 'K'
+    { 1, 6, 13, 14, 6579 }, // 'L'
+    { 1, 6, 15, 14, 6761 }, // 'M'
+    { 1, 6, 13, 14, 6971 }, // 'N'
+    { 1, 6, 13, 14, 7153 }, // 'O'
+    { 1, 6, 13, 14, 7335 }, // 'P'
+    { 1, 6, 13, 14, 7517 }, // 'Q'
+    { 1, 6, 13, 14, 7699 }, // 'R'
+    { 1, 6, 13, 14, 7881 }, // 'S'
+    { 1, 6, 13, 14, 8063 }, // 'T'
+    { 1, 6, 13, 14, 8245 }, // 'U'
+    { 1, 6, 13, 14, 8427 }, // 'V'
+    { 1, 6, 15, 14, 8609 }, // 'W'
+    { 1, 6, 13, 14, 8819 }, // 'X'
+    { 1, 6, 13, 14, 9001 }, // 'Y'
+    { 1, 6, 13, 14, 9183 }, // 'Z'
+    { 3, 6, 9, 14, 9365 }, // '['
+    { 1, 8, 15, 12, 9491 }, // '\\'
+    { 3, 6, 9, 14, 9671 }, // ']'
+    { 1, 6, 13, 14, 9797 }, // '^'
+    { 0, 18, 16, 2, 9979 }, // '_'
+    { 5, 6, 9, 7, 10011 }, // '`'
+    { 1, 10, 13, 10, 10074 }, // 'a'
+    { 1, 8, 13, 12, 10204 }, // 'b'
+    { 1, 10, 11, 10, 10360 }, // 'c'
+    { 1, 8, 13, 12, 10470 }, // 'd'
+    { 1, 10, 13, 10, 10626 }, // 'e'
+    { 3, 8, 11, 12, 10756 }, // 'f'
+    { 1, 10, 13, 10, 10888 }, // 'g'
+    { 1, 6, 13, 14, 11018 }, // 'h'
+    { 3, 6, 9, 14, 11200 }, // 'i'
+    { 7, 8, 5, 12, 11326 }, // 'j'
+    { 1, 6, 13, 14, 11386 }, // 'k'
+    { 3, 6, 9, 14, 11568 }, // 'l'
+    { 1, 10, 15, 10, 11694 }, // 'm'
+    { 1, 10, 13, 10, 11844 }, // 'n'
+    { 1, 10, 13, 10, 11974 }, // 'o'
+    { 1, 10, 13, 10, 12104 }, // 'p'
+    { 1, 10, 13, 10, 12234 }, // 'q'
+    { 1, 10, 13, 10, 12364 }, // 'r'
+    { 1, 10, 13, 10, 12494 }, // 's'
+    { 1, 8, 13, 12, 12624 }, // 't'
+    { 1, 10, 13, 10, 12780 }, // 'u'
+    { 1, 10, 13, 10, 12910 }, // 'v'
+    { 1, 10, 15, 10, 13040 }, // 'w'
+    { 1, 10, 13, 10, 13190 }, // 'x'
+    { 1, 10, 13, 10, 13320 }, // 'y'
+    { 1, 10, 13, 10, 13450 }, // 'z'
+    { 1, 6, 13, 14, 13580 }, // '{'
+    { 5, 6, 5, 14, 13762 }, // '|'
+    { 1, 6, 13, 14, 13832 }, // '}'
+    { 1, 6, 13, 7, 14014 }, // '~'
+};
+
+constexpr uint8_t c64Coverage20[] = {
+    // '!'
+     24, 172, 172, 172, 131,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+      3,  24,  24,  24,  18,
+      0,   0,   0,   0,   0,
+     34, 244, 244, 244, 186,
+     36, 255, 255, 255, 196,
+    // '"'
+      8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  60,  60,  60,  51,   0,   0,   0,  14,  60,  60,  60,  40,
+    // '#'
+      0,   8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,   0,   0,
+      0,  12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,  12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,  12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+    196, 198, 255, 255, 255, 247, 196, 196, 196, 210, 255, 255, 255, 236, 196, 122,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+     48,  57, 255, 255, 255, 226,  48,  48,  48,  96, 255, 255, 255, 187,  48,  30,
+      0,  12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+    220, 221, 255, 255, 255, 250, 220, 220, 220, 228, 255, 255, 255, 244, 220, 137,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+     24,  34, 255, 255, 255, 223,  24,  24,  24,  78, 255, 255, 255, 179,  24,  15,
+      0,  12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,  12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,  12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+    // '$'
+      0,   0,   0,   0,  24, 172, 172, 172, 131,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  17, 184, 194, 255, 255, 255, 239, 184, 184, 184, 123,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      9, 196, 201, 255, 228,  60,  60,  60,  60,  60,  60,  60,  40,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+      2,  48,  67, 255, 249, 208, 208, 208, 208, 208, 149,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   3,  36,  36,  36,  36,  36,  87, 255, 245, 220, 147,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+     10, 232, 232, 232, 232, 232, 232, 232, 237, 255, 190,  24,  16,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,  20,  20,  20,  53, 255, 255, 255, 198,  12,   8,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // '%'
+      8, 172, 172, 172, 147,   0,   0,   0,   0,   0,  48, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  43, 184, 204, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  60,  60,  60,  51,   0,  36, 196, 210, 255, 200,  60,  40,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,  29, 208, 217, 255, 207,  48,  34,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  20, 220, 225, 255, 214,  36,  27,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+     10, 232, 234, 255, 223,  24,  19,   0,  54, 232, 232, 232, 155,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 233,  12,  10,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 232,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+    // '&'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      2,  60,  78, 255, 247, 196, 196, 196, 210, 255, 200,  60,  40,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 207,  48,  34,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,   0,   0,
+     10, 220, 223, 255, 225,  36,  36,  36,  79, 220, 220, 220, 220, 220, 137,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 179,  24,  15,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 255, 255, 252, 244, 152,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+    // '''
+      0,   0,   0,   0,  40, 172, 172, 172, 115,
+      0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,  34, 184, 200, 255, 204,  72,  48,
+      0,   0,  48, 255, 255, 255, 184,   0,   0,
+     27, 196, 207, 255, 210,  60,  43,   0,   0,
+     36, 255, 255, 255, 196,   0,   0,   0,   0,
+      6,  48,  48,  48,  36,   0,   0,   0,   0,
+    // '('
+      0,   0,   0,   0,  32, 172, 172, 172, 123,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,  25, 184, 197, 255, 212,  72,  51,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+     18, 196, 204, 255, 219,  60,  45,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+      2,  24,  56, 255, 251, 232, 177,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,   1,  12,  57, 255, 253, 244, 175,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+    // ')'
+     16, 172, 172, 172, 139,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+      6,  72,  97, 255, 242, 184, 140,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,   8,  60,  96, 255, 241, 196, 140,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,  32, 232, 236, 255, 201,  24,  17,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+     22, 244, 245, 255, 210,  12,   9,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+    // '*'
+      0,   8, 184, 184, 184, 158,   0,   0,   0,  43, 184, 184, 184, 123,   0,   0,
+      0,  12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,   2,  60,  78, 255, 247, 196, 196, 196, 210, 255, 200,  60,  40,   0,   0,
+      0,   0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,   0,   0,
+    208, 208, 208, 212, 255, 255, 255, 255, 255, 255, 255, 242, 208, 208, 208, 130,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+     36,  36,  36,  56, 255, 255, 255, 255, 255, 255, 255, 194,  36,  36,  36,  22,
+      0,   0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,   0,   0,
+      0,   7, 232, 234, 255, 223,  24,  24,  24,  78, 255, 249, 232, 155,   0,   0,
+      0,   8, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,   0,  12,  12,  12,  10,   0,   0,   0,   2,  12,  12,  12,   8,   0,   0,
+    // '+'
+      0,   0,   0,   0,  25, 184, 184, 184, 140,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      9, 208, 208, 208, 214, 255, 255, 255, 244, 208, 208, 208, 139,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      1,  36,  36,  36,  66, 255, 255, 255, 204,  36,  36,  36,  24,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,  12,  12,  12,   9,   0,   0,   0,   0,
+    // ','
+     32, 232, 232, 232, 177,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+    // '-'
+      9, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 139,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      1,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  24,
+    // '.'
+     32, 232, 232, 232, 177,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+    // '/'
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51, 184, 184, 184, 115,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+      0,   0,   0,   0,   0,   0,   0,   0,  45, 196, 212, 255, 191,  60,  37,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,   0,   0,   0,   0,   0,  39, 208, 219, 255, 197,  48,  32,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,   0,   0,
+      0,   0,   0,   0,  30, 220, 226, 255, 204,  36,  25,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,   0,   0,
+      0,   0,  21, 232, 235, 255, 212,  24,  18,   0,   0,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,   0,   0,
+     11, 244, 245, 255, 221,  12,   9,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    // '0'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  36, 196, 210, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 249, 208, 178,  48,  96, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 208,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 225,  36,  29,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // '1'
+      0,   0,   0,   0,  24, 172, 172, 172, 131,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  18, 196, 204, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   4,  48,  77, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+     11, 244, 244, 244, 245, 255, 255, 255, 253, 244, 244, 244, 163,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // '2'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  60,  60,  60,  51,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,  39, 208, 219, 255, 197,  48,  32,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,  20, 220, 220, 220, 185,  36,  36,  36,  25,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+     10, 232, 234, 255, 223,  24,  19,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 254, 244, 244, 244, 244, 244, 244, 244, 163,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // '3'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  60,  60,  60,  51,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,  29, 208, 208, 208, 219, 255, 197,  48,  32,
+      0,   0,   0,   0,  36, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,   5,  36,  36,  36,  87, 255, 245, 220, 147,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+     10, 232, 232, 232, 199,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // '4'
+      0,   0,   0,   0,   0,   0,   0,   0,  40, 172, 172, 172, 115,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,   0,   0,   0,   0,   0,  34, 184, 200, 255, 255, 255, 172,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,   0,   0,
+      0,   0,   0,   0,  27, 196, 207, 255, 255, 255, 255, 255, 172,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 255, 255, 255, 255, 172,   0,   0,
+      9, 208, 208, 208, 185,  48,  48,  48,  96, 255, 255, 255, 172,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+     12, 255, 255, 255, 250, 220, 220, 220, 228, 255, 255, 255, 244, 220, 137,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+      1,  24,  24,  24,  24,  24,  24,  24,  78, 255, 255, 255, 179,  24,  15,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+    // '5'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 115,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 230,  72,  72,  72,  72,  72,  72,  72,  48,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 247, 196, 196, 196, 196, 196, 140,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      2,  48,  48,  48,  48,  48,  48,  48,  96, 255, 242, 208, 139,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+     10, 232, 232, 232, 199,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // '6'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  14,  60,  60,  60,  40,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 249, 208, 208, 208, 208, 208, 149,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 225,  36,  36,  36,  87, 255, 245, 220, 147,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // '7'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 115,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 230,  72,  72,  72, 115, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  60,  60,  60,  51,   0,  36, 196, 210, 255, 200,  60,  40,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,  29, 208, 217, 255, 207,  48,  34,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // '8'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  48,  67, 255, 249, 208, 208, 208, 219, 255, 197,  48,  32,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     10, 220, 223, 255, 225,  36,  36,  36,  87, 255, 245, 220, 147,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // '9'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  48,  67, 255, 249, 208, 208, 208, 219, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      0,   0,   3,  36,  36,  36,  36,  36,  87, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+     10, 232, 232, 232, 199,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // ':'
+     24, 172, 172, 172, 131,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+      8,  60,  60,  60,  45,
+      0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,
+     32, 232, 232, 232, 177,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+    // ';'
+     24, 172, 172, 172, 131,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+      8,  60,  60,  60,  45,
+      0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,
+     32, 232, 232, 232, 177,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+    // '<'
+      0,   0,   0,   0,   0,   0,  32, 172, 172, 172, 172, 172, 115,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,
+      0,   0,   0,   0,  25, 184, 197, 255, 212,  72,  72,  72,  48,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  18, 196, 204, 255, 219,  60,  45,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+      9, 208, 212, 255, 226,  48,  39,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,  36,  56, 255, 250, 220, 178,   0,   0,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+      0,   0,   2,  24,  56, 255, 251, 232, 177,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,  12,  57, 255, 253, 244, 244, 244, 163,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,
+    // '='
+      9, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 131,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      2,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  32,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     10, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 147,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      1,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  16,
+    // '>'
+      8, 172, 172, 172, 172, 172, 139,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+      3,  72,  72,  72,  97, 255, 242, 184, 140,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,   8,  60,  96, 255, 241, 196, 140,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,   0,   0,   9,  48,  96, 255, 242, 208, 139,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,  41, 220, 228, 255, 194,  36,  24,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,  32, 232, 236, 255, 201,  24,  17,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+     11, 244, 244, 244, 245, 255, 210,  12,   9,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+    // '?'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  60,  60,  60,  51,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,  39, 208, 219, 255, 197,  48,  32,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,  30, 220, 226, 255, 204,  36,  25,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,  24,  24,  24,  18,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  34, 244, 244, 244, 186,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // '@'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  36, 196, 210, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   6,  36,  36,  36,  36,  36,  24,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  65, 232, 155,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 244, 244, 178,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'A'
+      0,   0,   0,   0,  24, 172, 172, 172, 131,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  17, 184, 194, 255, 255, 255, 239, 184, 132,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      9, 196, 201, 255, 228,  60,  60,  60, 105, 255, 239, 196, 131,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 249, 208, 208, 208, 219, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 225,  36,  36,  36,  87, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'B'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 249, 208, 208, 208, 219, 255, 197,  48,  32,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 225,  36,  36,  36,  87, 255, 245, 220, 147,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'C'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  14,  60,  60,  60,  40,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,  54, 232, 232, 232, 155,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'D'
+      8, 172, 172, 172, 172, 172, 172, 172, 131,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+     12, 255, 255, 255, 230,  72, 106, 255, 239, 184, 132,   0,   0,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 220,   0,  11,  60, 105, 255, 239, 196, 131,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  43, 232, 237, 255, 190,  24,  16,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 254, 244, 246, 255, 198,  12,   8,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+    // 'E'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 115,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 230,  72,  72,  72,  72,  72,  72,  72,  48,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 249, 208, 208, 208, 159,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+     12, 255, 255, 255, 225,  36,  36,  36,  27,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 254, 244, 244, 244, 244, 244, 244, 244, 163,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // 'F'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 115,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 230,  72,  72,  72,  72,  72,  72,  72,  48,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 249, 208, 208, 208, 159,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+     12, 255, 255, 255, 225,  36,  36,  36,  27,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+    // 'G'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  14,  60,  60,  60,  40,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,  39, 208, 208, 208, 208, 208, 139,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   6,  36,  87, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'H'
+      8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 249, 208, 208, 208, 219, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 225,  36,  36,  36,  87, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'I'
+     16, 172, 172, 172, 172, 172, 172, 172, 123,
+     24, 255, 255, 255, 255, 255, 255, 255, 184,
+      6,  72,  97, 255, 255, 255, 212,  72,  51,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+     22, 244, 245, 255, 255, 255, 253, 244, 175,
+     24, 255, 255, 255, 255, 255, 255, 255, 184,
+    // 'J'
+      0,   0,   0,   0,  24, 172, 172, 172, 172, 172, 172, 172, 115,
+      0,   0,   0,   0,  36, 255, 255, 255, 255, 255, 255, 255, 172,
+      0,   0,   0,   0,  10,  72, 106, 255, 255, 255, 204,  72,  48,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+     10, 232, 232, 232, 199,   0,  48, 255, 255, 255, 184,   0,   0,
+     11, 248, 248, 255, 220,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,  19, 255, 254, 244, 246, 255, 198,  12,   8,   0,   0,
+      0,   0,  22, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+    // 'K'
+      8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  34, 184, 200, 255, 204,  72,  48,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 247, 196, 207, 255, 210,  60,  43,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 217,  48,  36,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 249, 220, 168,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+     12, 255, 255, 255, 223,  24,  67, 255, 250, 232, 166,   0,   0,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 220,   0,   2,  12,  69, 255, 252, 244, 163,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'L'
+      8, 172, 172, 172, 147,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 254, 244, 244, 244, 244, 244, 244, 244, 163,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // 'M'
+      8, 172, 172, 172, 147,   0,   0,   0,   0,   0,  48, 172, 172, 172, 107,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 245, 184, 149,   0,  43, 184, 204, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 208,   0,  60, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 244, 196, 210, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 226,  48,  87, 255, 207,  48, 106, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,  48, 255, 196,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   6,  36,  27,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+    // 'N'
+      8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 245, 184, 149,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 208,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 244, 196, 210, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 225,  36,  77, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   4,  24,  78, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'O'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'P'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 249, 208, 208, 208, 219, 255, 197,  48,  32,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 225,  36,  36,  36,  36,  36,  25,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+    // 'Q'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      1,  24,  45, 255, 252, 232, 232, 232, 237, 255, 190,  24,  16,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   1,  12,  12,  12,  57, 255, 255, 255, 252, 244, 163,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,
+    // 'R'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 249, 208, 208, 208, 219, 255, 197,  48,  32,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 204,  36,  25,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+     12, 255, 255, 255, 223,  24,  67, 255, 250, 232, 166,   0,   0,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 220,   0,   2,  12,  69, 255, 252, 244, 163,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'S'
+      0,   0,  16, 172, 172, 172, 172, 172, 172, 172, 123,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      8, 184, 190, 255, 230,  72,  72,  72, 115, 255, 235, 184, 123,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  14,  60,  60,  60,  40,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+      2,  48,  67, 255, 249, 208, 208, 208, 208, 208, 149,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   3,  36,  36,  36,  36,  36,  87, 255, 245, 220, 147,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+     10, 232, 232, 232, 199,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'T'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 115,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      3,  72,  72,  72,  97, 255, 255, 255, 212,  72,  72,  72,  48,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // 'U'
+      8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'V'
+      8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      1,  24,  45, 255, 252, 232, 232, 232, 237, 255, 190,  24,  16,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   1,  12,  46, 255, 255, 255, 198,  12,   8,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // 'W'
+      8, 172, 172, 172, 147,   0,   0,   0,   0,   0,  48, 172, 172, 172, 107,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,  39, 208, 159,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,  48, 255, 196,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 250, 220, 226, 255, 247, 220, 230, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 212,  24,  78, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 208,   0,  60, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 221,  12,   9,   0,   2,  12,  80, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+    // 'X'
+      8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  60,  78, 255, 247, 196, 196, 196, 210, 255, 200,  60,  40,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   4,  48,  77, 255, 255, 255, 207,  48,  34,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  20, 220, 225, 255, 255, 255, 247, 220, 158,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     10, 232, 234, 255, 223,  24,  24,  24,  78, 255, 249, 232, 155,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'Y'
+      8, 172, 172, 172, 147,   0,   0,   0,  40, 172, 172, 172, 115,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  48,  67, 255, 249, 208, 208, 208, 219, 255, 197,  48,  32,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   3,  36,  66, 255, 255, 255, 204,  36,  25,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // 'Z'
+      8, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 115,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      3,  72,  72,  72,  72,  72,  72,  72, 115, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,  36, 196, 210, 255, 200,  60,  40,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,  29, 208, 217, 255, 207,  48,  34,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  20, 220, 225, 255, 214,  36,  27,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+     10, 232, 234, 255, 223,  24,  19,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 254, 244, 244, 244, 244, 244, 244, 244, 163,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // '['
+     16, 172, 172, 172, 172, 172, 172, 172, 123,
+     24, 255, 255, 255, 255, 255, 255, 255, 184,
+     24, 255, 255, 255, 221,  72,  72,  72,  51,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 208,   0,   0,   0,   0,
+     24, 255, 255, 255, 253, 244, 244, 244, 175,
+     24, 255, 255, 255, 255, 255, 255, 255, 184,
+    // '\\'
+      8, 184, 184, 184, 158,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      2,  60,  78, 255, 247, 196, 159,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   4,  48,  77, 255, 247, 208, 159,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   5,  36,  77, 255, 247, 220, 158,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   4,  24,  78, 255, 249, 232, 155,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   2,  12,  80, 255, 252, 244, 152,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+    // ']'
+     16, 172, 172, 172, 172, 172, 172, 172, 123,
+     24, 255, 255, 255, 255, 255, 255, 255, 184,
+      6,  72,  72,  72, 106, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+      0,   0,   0,   0,  48, 255, 255, 255, 184,
+     22, 244, 244, 244, 246, 255, 255, 255, 184,
+     24, 255, 255, 255, 255, 255, 255, 255, 184,
+    // '^'
+      0,   0,   0,   0,  24, 172, 172, 172, 131,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  17, 184, 194, 255, 255, 255, 239, 184, 132,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      9, 196, 201, 255, 255, 255, 255, 255, 255, 255, 239, 196, 131,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      2,  48,  48,  48,  77, 255, 255, 255, 207,  48,  48,  48,  32,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // '_'
+    244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 152,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+    // '`'
+     24, 172, 172, 172, 131,   0,   0,   0,   0,
+     36, 255, 255, 255, 196,   0,   0,   0,   0,
+     10,  72, 106, 255, 239, 184, 132,   0,   0,
+      0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,  11,  60, 105, 255, 239, 196, 131,
+      0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,  11,  48,  48,  48,  32,
+    // 'a'
+      0,   0,  18, 196, 196, 196, 196, 196, 196, 196, 140,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   4,  48,  48,  48,  48,  48,  96, 255, 242, 208, 139,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,  20, 220, 220, 220, 220, 220, 228, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     10, 232, 234, 255, 223,  24,  24,  24,  78, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // 'b'
+      8, 184, 184, 184, 158,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 249, 208, 208, 208, 208, 208, 149,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 225,  36,  36,  36,  87, 255, 245, 220, 147,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'c'
+      0,   0,  18, 196, 196, 196, 196, 196, 196, 196, 140,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,
+      9, 208, 212, 255, 226,  48,  48,  48,  48,  48,  34,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,
+      0,  12,  34, 255, 254, 244, 244, 244, 244, 244, 175,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,
+    // 'd'
+      0,   0,   0,   0,   0,   0,   0,   0,  43, 184, 184, 184, 123,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,   0,  19, 208, 208, 208, 208, 208, 219, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     10, 220, 223, 255, 225,  36,  36,  36,  87, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // 'e'
+      0,   0,  18, 196, 196, 196, 196, 196, 196, 196, 140,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      9, 208, 212, 255, 226,  48,  48,  48,  96, 255, 242, 208, 139,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 250, 220, 220, 220, 228, 255, 255, 255, 172,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 255, 255, 223,  24,  24,  24,  24,  24,  24,  24,  16,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,  12,  34, 255, 254, 244, 244, 244, 244, 244, 175,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'f'
+      0,   0,   0,   0,  34, 184, 184, 184, 184, 184, 123,
+      0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,
+      0,   0,  27, 196, 207, 255, 210,  60,  60,  60,  40,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+     19, 208, 214, 255, 255, 255, 244, 208, 208, 208, 139,
+     24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      3,  36,  66, 255, 255, 255, 204,  36,  36,  36,  24,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // 'g'
+      0,   0,  18, 196, 196, 196, 196, 196, 196, 196, 196, 196, 131,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      9, 208, 212, 255, 226,  48,  48,  48,  96, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      1,  24,  45, 255, 252, 232, 232, 232, 237, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      0,   0,   1,  12,  12,  12,  12,  12,  69, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'h'
+      8, 172, 172, 172, 147,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 247, 196, 196, 196, 196, 196, 140,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 226,  48,  48,  48,  96, 255, 242, 208, 139,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'i'
+      0,   0,  24, 172, 172, 172, 131,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  10,  72,  72,  72,  55,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,
+     18, 196, 196, 196, 196, 196, 150,   0,   0,
+     24, 255, 255, 255, 255, 255, 196,   0,   0,
+      4,  48,  77, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+     22, 244, 245, 255, 255, 255, 253, 244, 175,
+     24, 255, 255, 255, 255, 255, 255, 255, 184,
+    // 'j'
+     34, 184, 184, 184, 132,
+     48, 255, 255, 255, 184,
+     11,  60,  60,  60,  43,
+      0,   0,   0,   0,   0,
+     39, 208, 208, 208, 149,
+     48, 255, 255, 255, 184,
+     48, 255, 255, 255, 184,
+     48, 255, 255, 255, 184,
+     48, 255, 255, 255, 184,
+     48, 255, 255, 255, 184,
+     48, 255, 255, 255, 184,
+     48, 255, 255, 255, 184,
+    // 'k'
+      8, 172, 172, 172, 147,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,  39, 208, 208, 208, 149,   0,   0,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 250, 220, 226, 255, 204,  36,  25,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 196,   0,   0,   0,   0,
+     12, 255, 255, 255, 223,  24,  67, 255, 250, 232, 166,   0,   0,
+     12, 255, 255, 255, 220,   0,  48, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 220,   0,   2,  12,  69, 255, 252, 244, 163,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'l'
+     16, 172, 172, 172, 172, 172, 131,   0,   0,
+     24, 255, 255, 255, 255, 255, 196,   0,   0,
+      6,  72,  97, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+      0,   0,  36, 255, 255, 255, 196,   0,   0,
+     22, 244, 245, 255, 255, 255, 253, 244, 175,
+     24, 255, 255, 255, 255, 255, 255, 255, 184,
+    // 'm'
+      9, 196, 196, 196, 168,   0,   0,   0,  45, 196, 196, 196, 131,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,   0,   0,
+     12, 255, 255, 255, 249, 208, 208, 208, 219, 255, 255, 255, 240, 208, 130,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+     12, 255, 255, 255, 223,  24,  67, 255, 201,  24,  89, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,  48, 255, 196,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   2,  12,   9,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+    // 'n'
+      9, 196, 196, 196, 196, 196, 196, 196, 196, 196, 140,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 226,  48,  48,  48,  96, 255, 242, 208, 139,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'o'
+      0,   0,  18, 196, 196, 196, 196, 196, 196, 196, 140,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      9, 208, 212, 255, 226,  48,  48,  48,  96, 255, 242, 208, 139,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 187,  12,   8,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 'p'
+      9, 196, 196, 196, 196, 196, 196, 196, 196, 196, 140,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 226,  48,  48,  48,  96, 255, 242, 208, 139,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 252, 232, 232, 232, 237, 255, 190,  24,  16,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 221,  12,  12,  12,  12,  12,   8,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+    // 'q'
+      0,   0,  18, 196, 196, 196, 196, 196, 196, 196, 196, 196, 131,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      9, 208, 212, 255, 226,  48,  48,  48,  96, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      1,  24,  45, 255, 252, 232, 232, 232, 237, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      0,   0,   1,  12,  12,  12,  12,  12,  69, 255, 255, 255, 172,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'r'
+      9, 196, 196, 196, 196, 196, 196, 196, 196, 196, 140,   0,   0,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     12, 255, 255, 255, 226,  48,  48,  48,  96, 255, 242, 208, 139,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,   8,  36,  36,  36,  24,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+    // 's'
+      0,   0,  18, 196, 196, 196, 196, 196, 196, 196, 196, 196, 131,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      9, 208, 212, 255, 226,  48,  48,  48,  48,  48,  48,  48,  32,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,  36,  56, 255, 250, 220, 220, 220, 220, 220, 158,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   2,  24,  24,  24,  24,  24,  78, 255, 249, 232, 155,
+      0,   0,   0,   0,   0,   0,   0,   0,  60, 255, 255, 255, 172,
+     11, 244, 244, 244, 244, 244, 244, 244, 246, 255, 187,  12,   8,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+    // 't'
+      0,   0,   0,   0,  25, 184, 184, 184, 140,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      9, 196, 196, 196, 204, 255, 255, 255, 241, 196, 196, 196, 131,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      2,  48,  48,  48,  77, 255, 255, 255, 207,  48,  48,  48,  32,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,  12,  57, 255, 253, 244, 244, 244, 163,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,
+    // 'u'
+      9, 196, 196, 196, 168,   0,   0,   0,  45, 196, 196, 196, 131,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      0,  12,  34, 255, 254, 244, 244, 244, 246, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // 'v'
+      9, 196, 196, 196, 168,   0,   0,   0,  45, 196, 196, 196, 131,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      1,  24,  45, 255, 252, 232, 232, 232, 237, 255, 190,  24,  16,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   1,  12,  46, 255, 255, 255, 198,  12,   8,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+    // 'w'
+      9, 196, 196, 196, 168,   0,   0,   0,   0,   0,  55, 196, 196, 196, 122,
+     12, 255, 255, 255, 220,   0,   0,   0,   0,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,  39, 208, 159,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 220,   0,  48, 255, 196,   0,  72, 255, 255, 255, 160,
+     12, 255, 255, 255, 250, 220, 226, 255, 247, 220, 230, 255, 255, 255, 160,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,
+      1,  24,  45, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179,  24,  15,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,   0,   0,
+      0,   0,  24, 255, 255, 255, 210,  12,  69, 255, 255, 255, 172,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,  60, 255, 255, 255, 172,   0,   0,
+    // 'x'
+      9, 196, 196, 196, 168,   0,   0,   0,  45, 196, 196, 196, 131,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      2,  48,  67, 255, 249, 208, 208, 208, 219, 255, 197,  48,  32,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+      0,   0,   3,  36,  66, 255, 255, 255, 204,  36,  25,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  21, 232, 235, 255, 255, 255, 250, 232, 166,   0,   0,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 184,   0,   0,
+     11, 244, 245, 255, 221,  12,  12,  12,  69, 255, 252, 244, 163,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+    // 'y'
+      9, 196, 196, 196, 168,   0,   0,   0,  45, 196, 196, 196, 131,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+     12, 255, 255, 255, 220,   0,   0,   0,  60, 255, 255, 255, 172,
+      1,  24,  45, 255, 252, 232, 232, 232, 237, 255, 255, 255, 172,
+      0,   0,  24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      0,   0,   1,  12,  12,  12,  57, 255, 255, 255, 187,  12,   8,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+    // 'z'
+      9, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 131,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+      2,  48,  48,  48,  48,  48,  87, 255, 255, 255, 197,  48,  32,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 184,   0,   0,
+      0,   0,   0,   0,  30, 220, 226, 255, 204,  36,  25,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,  21, 232, 235, 255, 212,  24,  18,   0,   0,   0,   0,
+      0,   0,  24, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+     11, 244, 245, 255, 255, 255, 253, 244, 244, 244, 244, 244, 163,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    // '{'
+      0,   0,   0,   0,   0,   0,  32, 172, 172, 172, 172, 172, 115,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,
+      0,   0,   0,   0,  25, 184, 197, 255, 212,  72,  72,  72,  48,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      9, 208, 208, 208, 214, 255, 217,  48,  36,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+      1,  36,  36,  36,  66, 255, 249, 220, 168,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,  12,  57, 255, 253, 244, 244, 244, 163,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,
+    // '|'
+     24, 172, 172, 172, 131,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+     36, 255, 255, 255, 196,
+    // '}'
+      8, 172, 172, 172, 172, 172, 139,   0,   0,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+      3,  72,  72,  72,  97, 255, 242, 184, 140,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,   6,  48,  87, 255, 244, 208, 208, 208, 139,
+      0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 255, 255, 172,
+      0,   0,   0,   0,  30, 220, 226, 255, 204,  36,  36,  36,  24,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+      0,   0,   0,   0,  36, 255, 255, 255, 196,   0,   0,   0,   0,
+     11, 244, 244, 244, 245, 255, 210,  12,   9,   0,   0,   0,   0,
+     12, 255, 255, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,
+    // '~'
+      8, 172, 172, 172, 172, 172, 139,   0,   0,   0,  48, 172, 115,
+     12, 255, 255, 255, 255, 255, 208,   0,   0,   0,  72, 255, 172,
+     12, 255, 255, 255, 255, 255, 242, 184, 184, 184, 204, 255, 172,
+     12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+     12, 255, 237,  60,  87, 255, 255, 255, 255, 255, 200,  60,  40,
+     12, 255, 232,   0,  36, 255, 255, 255, 255, 255, 184,   0,   0,
+      2,  48,  43,   0,   6,  48,  48,  48,  48,  48,  34,   0,   0,
+};
+
+constexpr BakedGlyph c64Glyphs10[] = {
+    { 0, 0, 0, 0, 0 }, // ' '
+    { 2, 3, 3, 7, 0 }, // '!'
+    { 0, 3, 7, 3, 21 }, // '"'
+    { 0, 3, 8, 7, 42 }, // '#'
+    { 0, 3, 7, 7, 98 }, // '$'
+    { 0, 3, 7, 7, 147 }, // '%'
+    { 0, 3, 8, 7, 196 }, // '&'
+    { 2, 3, 5, 4, 252 }, // '''
+    { 1, 3, 5, 7, 272 }, // '('
+    { 1, 3, 5, 7, 307 }, // ')'
+    { 0, 4, 8, 6, 342 }, // '*'
+    { 0, 4, 7, 6, 390 }, // '+'
+    { 2, 8, 3, 2, 432 }, // ','
+    { 0, 6, 7, 2, 438 }, // '-'
+    { 2, 8, 3, 2, 452 }, // '.'
+    { 0, 4, 8, 6, 458 }, // '/'
+    { 0, 3, 7, 7, 506 }, // '0'
+    { 0, 3, 7, 7, 555 }, // '1'
+    { 0, 3, 7, 7, 604 }, // '2'
+    { 0, 3, 7, 7, 653 }, // '3'
+    { 0, 3, 8, 7, 702 }, // '4'
+    { 0, 3, 7, 7, 758 }, // '5'
+    { 0, 3, 7, 7, 807 }, // '6'
+    { 0, 3, 7, 7, 856 }, // '7'
+    { 0, 3, 7, 7, 905 }, // '8'
+    { 0, 3, 7, 7, 954 }, // '9'
+    { 2, 3, 3, 7, 1003 }, // ':'
+    { 2, 3, 3, 7, 1024 }, // ';'
+    { 0, 3, 7, 7, 1045 }, // '<'
+    { 0, 5, 7, 4, 1094 }, // '='
+    { 0, 3, 7, 7, 1122 }, // '>'
+    { 0, 3, 7, 7, 1171 }, // '?'
+    { 0, 3, 7, 7, 1220 }, // '@'
+    { 0, 3, 7, 7, 1269 }, // 'A'
+    { 0, 3, 7, 7, 1318 }, // 'B'
+    { 0, 3, 7, 7, 1367 }, // 'C'
+    { 0, 3, 7, 7, 1416 }, // 'D'
+    { 0, 3, 7, 7, 1465 }, // 'E'
+    { 0, 3, 7, 7, 1514 }, // 'F'
+    { 0, 3, 7, 7, 1563 }, // 'G'
+    { 0, 3, 7, 7, 1612 }, // 'H'
+    { 1, 3, 5, 7, 1661 }, // 'I'
+    { 0, 3, 7, 7, 1696 }, // 'J'
+    { 0, 3, 7, 7, 1745 }, // 'K'
+    { 0, 3, 7, 7, 1794 }, // 'L'
+    { 0, 3, 8, 7, 1843 }, // 'M'
+    { 0, 3, 7, 7, 1899 }, // 'N'
+    { 0, 3, 7, 7, 1948 }, // 'O'
+    { 0, 3, 7, 7, 1997 }, // 'P'
+    { 0, 3, 7, 7, 2046 }, // 'Q'
+    { 0, 3, 7, 7, 2095 }, // 'R'
+    { 0, 3, 7, 7, 2144 }, // 'S'
+    { 0, 3, 7, 7, 2193 }, // 'T'
+    { 0, 3, 7, 7, 2242 }, // 'U'
+    { 0, 3, 7, 7, 2291 }, // 'V'
+    { 0, 3, 8, 7, 2340 }, // 'W'
+    { 0, 3, 7, 7, 2396 }, // 'X'
+    { 0, 3, 7, 7, 2445 }, // 'Y'
+    { 0, 3, 7, 7, 2494 }, // 'Z'
+    { 1, 3, 5, 7, 2543 }, // '['
+    { 0, 4, 8, 6, 2578 }, // '\\'
+    { 1, 3, 5, 7, 2626 }, // ']'
+    { 0, 3, 7, 7, 2661 }, // '^'
+    { 0, 9, 8, 1, 2710 }, // '_'
+    { 2, 3, 5, 4, 2718 }, // '`'
+    { 0, 5, 7, 5, 2738 }, // 'a'
+    { 0, 4, 7, 6, 2773 }, // 'b'
+    { 0, 5, 6, 5, 2815 }, // 'c'
+    { 0, 4, 7, 6, 2845 }, // 'd'
+    { 0, 5, 7, 5, 2887 }, // 'e'
+    { 1, 4, 6, 6, 2922 }, // 'f'
+    { 0, 5, 7, 5, 2958 }, // 'g'
+    { 0, 3, 7, 7, 2993 }, // 'h'
+    { 1, 3, 5, 7, 3042 }, // 'i'
+    { 3, 4, 3, 6, 3077 }, // 'j'
+    { 0, 3, 7, 7, 3095 }, // 'k'
+    { 1, 3, 5, 7, 3144 }, // 'l'
+    { 0, 5, 8, 5, 3179 }, // 'm'
+    { 0, 5, 7, 5, 3219 }, // 'n'
+    { 0, 5, 7, 5, 3254 }, // 'o'
+    { 0, 5, 7, 5, 3289 }, // 'p'
+    { 0, 5, 7, 5, 3324 }, // 'q'
+    { 0, 5, 7, 5, 3359 }, // 'r'
+    { 0, 5, 7, 5, 3394 }, // 's'
+    { 0, 4, 7, 6, 3429 }, // 't'
+    { 0, 5, 7, 5, 3471 }, // 'u'
+    { 0, 5, 7, 5, 3506 }, // 'v'
+    { 0, 5, 8, 5, 3541 }, // 'w'
+    { 0, 5, 7, 5, 3581 }, // 'x'
+    { 0, 5, 7, 5, 3616 }, // 'y'
+    { 0, 5, 7, 5, 3651 }, // 'z'
+    { 0, 3, 7, 7, 3686 }, // '{'
+    { 2, 3, 3, 7, 3735 }, // '|'
+    { 0, 3, 7, 7, 3756 }, // '}'
+    { 0, 3, 7, 4, 3805 }, // '~'
+};
+
+constexpr uint8_t c64Coverage10[] = {
+    // '!'
+     13, 216, 192,
+     16, 255, 228,
+     16, 255, 228,
+     16, 255, 228,
+     16, 255, 228,
+      0,  12,  10,
+     15, 252, 224,
+    // '"'
+      3, 216, 202,   0,  23, 216, 182,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  28,  26,   0,   3,  28,  23,
+    // '#'
+      3, 216, 202,   0,  23, 216, 182,   0,
+      4, 255, 240,   0,  28, 255, 216,   0,
+    228, 255, 254, 228, 231, 255, 251, 185,
+     27, 255, 241,  24,  49, 255, 219,  19,
+    240, 255, 255, 240, 241, 255, 253, 195,
+     15, 255, 240,  12,  38, 255, 217,   9,
+      4, 255, 240,   0,  28, 255, 216,   0,
+    // '$'
+      0,   0,  13, 216, 192,   0,   0,
+      0,  10, 222, 255, 252, 220, 185,
+      3, 229, 241,  28,  28,  28,  23,
+      0,  34, 254, 232, 232, 199,   0,
+      0,   0,  16,  16,  42, 253, 202,
+      3, 244, 244, 244, 245, 221,  10,
+      0,  12,  27, 255, 228,   3,   0,
+    // '%'
+      3, 216, 202,   0,   0,  30, 182,
+      4, 255, 240,   0,  24, 225, 216,
+      0,  28,  26,  21, 231, 223,  23,
+      0,   0,  14, 234, 230,  20,   0,
+      0,  11, 241, 233,  14,   0,   0,
+      3, 244, 240,  10,  26, 244, 205,
+      4, 244,   3,   0,  28, 255, 216,
+    // '&'
+      0,  10, 216, 216, 216, 185,   0,   0,
+      3, 221, 242,  36,  60, 250, 185,   0,
+      0,  38, 254, 228, 231, 223,  23,   0,
+      0,  12, 255, 255, 230,  20,   0,   0,
+      3, 240, 241,  16,  40, 240, 240, 195,
+      4, 255, 240,   0,  28, 255, 217,   9,
+      0,  15, 255, 252, 252, 255, 255, 204,
+    // '''
+      0,   0,  23, 216, 182,
+      0,  20, 223, 225,  30,
+     14, 230, 231,  24,   0,
+      1,  24,  21,   0,   0,
+    // '('
+      0,   0,  20, 216, 185,
+      0,  13, 223, 231,  30,
+     10, 229, 234,  24,   0,
+     12, 255, 232,   0,   0,
+     12, 255, 232,   0,   0,
+      0,  27, 254, 217,   0,
+      0,   0,  27, 255, 216,
+    // ')'
+     10, 216, 195,   0,   0,
+      1,  49, 252, 195,   0,
+      0,   1,  49, 252, 195,
+      0,   0,  24, 255, 220,
+      0,   0,  24, 255, 220,
+      0,  15, 245, 229,  10,
+     11, 252, 232,   3,   0,
+    // '*'
+      3, 220, 206,   0,  24, 220, 185,   0,
+      0,  38, 254, 228, 231, 223,  23,   0,
+    232, 233, 255, 255, 255, 252, 232, 188,
+     16,  27, 255, 255, 255, 222,  16,  13,
+      3, 244, 240,  12,  38, 254, 205,   0,
+      0,   4,   3,   0,   0,   4,   3,   0,
+    // '+'
+      0,   0,  13, 220, 195,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      3, 232, 233, 255, 253, 232, 195,
+      0,  16,  31, 255, 229,  16,  13,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,   0,   4,   3,   0,   0,
+    // ','
+     15, 244, 217,
+     16, 255, 228,
+    // '-'
+      3, 232, 232, 232, 232, 232, 195,
+      0,  16,  16,  16,  16,  16,  13,
+    // '.'
+     15, 244, 217,
+     16, 255, 228,
+    // '/'
+      0,   0,   0,   0,   0,  30, 220, 178,
+      0,   0,   0,   0,  24, 231, 220,  22,
+      0,   0,   0,  21, 234, 223,  20,   0,
+      0,   0,  15, 241, 229,  13,   0,   0,
+      0,  11, 244, 233,  10,   0,   0,   0,
+      3, 252, 240,   3,   0,   0,   0,   0,
+    // '0'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,  21, 231, 255, 216,
+      4, 255, 254, 212,  49, 255, 216,
+      4, 255, 241,  14,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // '1'
+      0,   0,  13, 216, 192,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,  10, 229, 255, 228,   0,   0,
+      0,   1,  38, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      3, 252, 252, 255, 255, 252, 212,
+    // '2'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      0,  28,  26,   0,  28, 255, 216,
+      0,   0,   0,  21, 234, 223,  20,
+      0,  11, 240, 219,  16,  13,   0,
+      3, 244, 240,  10,   0,   0,   0,
+      4, 255, 255, 252, 252, 252, 212,
+    // '3'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      0,  28,  26,   0,  28, 255, 216,
+      0,   0,  14, 232, 234, 223,  20,
+      0,   0,   1,  16,  42, 253, 202,
+      3, 244, 228,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // '4'
+      0,   0,   0,   0,  23, 216, 182,   0,
+      0,   0,   0,  20, 223, 255, 216,   0,
+      0,   0,  14, 230, 255, 255, 216,   0,
+      3, 232, 219,  24,  49, 255, 216,   0,
+      4, 255, 255, 240, 241, 255, 253, 195,
+      0,  12,  12,  12,  38, 255, 217,   9,
+      0,   0,   0,   0,  28, 255, 216,   0,
+    // '5'
+      3, 216, 216, 216, 216, 216, 182,
+      4, 255, 242,  36,  36,  36,  30,
+      4, 255, 254, 228, 228, 195,   0,
+      0,  24,  24,  24,  49, 252, 195,
+      0,   0,   0,   0,  28, 255, 216,
+      3, 244, 228,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // '6'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,   3,  28,  23,
+      4, 255, 254, 232, 232, 199,   0,
+      4, 255, 241,  16,  42, 253, 202,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // '7'
+      3, 216, 216, 216, 216, 216, 182,
+      4, 255, 242,  36,  60, 255, 216,
+      0,  28,  26,  21, 231, 223,  23,
+      0,   0,  14, 234, 230,  20,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+    // '8'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  34, 254, 232, 234, 223,  20,
+      3, 240, 241,  16,  42, 253, 202,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // '9'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  34, 254, 232, 234, 255, 216,
+      0,   0,  16,  16,  42, 255, 216,
+      3, 244, 228,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // ':'
+     13, 216, 192,
+     16, 255, 228,
+      1,  28,  24,
+      0,   0,   0,
+      0,   0,   0,
+     15, 244, 217,
+     16, 255, 228,
+    // ';'
+     13, 216, 192,
+     16, 255, 228,
+      1,  28,  24,
+      0,   0,   0,
+      0,   0,   0,
+     15, 244, 217,
+     16, 255, 228,
+    // '<'
+      0,   0,   0,  20, 216, 216, 182,
+      0,   0,  13, 223, 231,  36,  30,
+      0,  10, 229, 234,  24,   0,   0,
+      3, 233, 241,  21,   0,   0,   0,
+      0,  27, 255, 217,   0,   0,   0,
+      0,   0,  27, 254, 217,   0,   0,
+      0,   0,   0,  27, 255, 252, 212,
+    // '='
+      3, 228, 228, 228, 228, 228, 192,
+      0,  24,  24,  24,  24,  24,  20,
+      3, 240, 240, 240, 240, 240, 202,
+      0,  12,  12,  12,  12,  12,  10,
+    // '>'
+      3, 216, 216, 195,   0,   0,   0,
+      0,  36,  49, 252, 195,   0,   0,
+      0,   0,   1,  49, 252, 195,   0,
+      0,   0,   0,   2,  49, 252, 195,
+      0,   0,   0,  22, 241, 222,  13,
+      0,   0,  15, 245, 229,  10,   0,
+      3, 252, 252, 232,   3,   0,   0,
+    // '?'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      0,  28,  26,   0,  28, 255, 216,
+      0,   0,   0,  21, 234, 223,  20,
+      0,   0,  15, 241, 229,  13,   0,
+      0,   0,   0,  12,  10,   0,   0,
+      0,   0,  15, 252, 224,   0,   0,
+    // '@'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,  21, 231, 255, 216,
+      4, 255, 240,  24, 255, 255, 216,
+      4, 255, 240,   1,  16,  16,  13,
+      4, 255, 240,   0,   0,  34, 205,
+      0,  15, 255, 252, 252, 217,   3,
+    // 'A'
+      0,   0,  13, 216, 192,   0,   0,
+      0,  10, 222, 255, 252, 189,   0,
+      3, 229, 241,  28,  52, 252, 192,
+      4, 255, 254, 232, 234, 255, 216,
+      4, 255, 241,  16,  42, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+    // 'B'
+      3, 216, 216, 216, 216, 185,   0,
+      4, 255, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 254, 232, 234, 223,  20,
+      4, 255, 241,  16,  42, 253, 202,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 255, 252, 252, 220,   3,
+    // 'C'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,   3,  28,  23,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,  26, 244, 205,
+      0,  15, 255, 252, 252, 220,   3,
+    // 'D'
+      3, 216, 216, 216, 192,   0,   0,
+      4, 255, 242,  56, 252, 189,   0,
+      4, 255, 240,   2,  52, 252, 192,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,  22, 245, 221,  10,
+      4, 255, 255, 252, 228,   3,   0,
+    // 'E'
+      3, 216, 216, 216, 216, 216, 182,
+      4, 255, 242,  36,  36,  36,  30,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 254, 232, 206,   0,   0,
+      4, 255, 241,  16,  14,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 255, 252, 252, 252, 212,
+    // 'F'
+      3, 216, 216, 216, 216, 216, 182,
+      4, 255, 242,  36,  36,  36,  30,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 254, 232, 206,   0,   0,
+      4, 255, 241,  16,  14,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+    // 'G'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,   3,  28,  23,
+      4, 255, 240,  21, 232, 232, 195,
+      4, 255, 240,   1,  42, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // 'H'
+      3, 216, 202,   0,  23, 216, 182,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 254, 232, 234, 255, 216,
+      4, 255, 241,  16,  42, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+    // 'I'
+     10, 216, 216, 216, 185,
+      1,  49, 255, 231,  30,
+      0,  16, 255, 228,   0,
+      0,  16, 255, 228,   0,
+      0,  16, 255, 228,   0,
+      0,  16, 255, 228,   0,
+     11, 252, 255, 255, 216,
+    // 'J'
+      0,   0,  13, 216, 216, 216, 182,
+      0,   0,   2,  56, 255, 225,  30,
+      0,   0,   0,  24, 255, 220,   0,
+      0,   0,   0,  24, 255, 220,   0,
+      0,   0,   0,  24, 255, 220,   0,
+      3, 240, 228,  24, 255, 220,   0,
+      0,  10, 255, 252, 228,   3,   0,
+    // 'K'
+      3, 216, 202,   0,  23, 216, 182,
+      4, 255, 240,  20, 223, 225,  30,
+      4, 255, 254, 230, 231,  24,   0,
+      4, 255, 255, 234,  21,   0,   0,
+      4, 255, 255, 254, 213,   0,   0,
+      4, 255, 240,  34, 254, 209,   0,
+      4, 255, 240,   0,  31, 255, 212,
+    // 'L'
+      3, 216, 202,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 255, 252, 252, 252, 212,
+    // 'M'
+      3, 216, 202,   0,   0,  30, 216, 175,
+      4, 255, 253, 199,  24, 225, 255, 208,
+      4, 255, 255, 253, 231, 255, 255, 208,
+      4, 255, 241,  45, 230,  56, 255, 208,
+      4, 255, 240,   1,  14,  36, 255, 208,
+      4, 255, 240,   0,   0,  36, 255, 208,
+      4, 255, 240,   0,   0,  36, 255, 208,
+    // 'N'
+      3, 216, 202,   0,  23, 216, 182,
+      4, 255, 253, 199,  28, 255, 216,
+      4, 255, 255, 253, 231, 255, 216,
+      4, 255, 255, 255, 255, 255, 216,
+      4, 255, 241,  38, 255, 255, 216,
+      4, 255, 240,   1,  38, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+    // 'O'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // 'P'
+      3, 216, 216, 216, 216, 185,   0,
+      4, 255, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 254, 232, 234, 223,  20,
+      4, 255, 241,  16,  16,  13,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+    // 'Q'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  23, 255, 244, 245, 221,  10,
+      0,   0,   4,  27, 255, 255, 212,
+    // 'R'
+      3, 216, 216, 216, 216, 185,   0,
+      4, 255, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 254, 232, 234, 223,  20,
+      4, 255, 255, 255, 229,  13,   0,
+      4, 255, 240,  34, 254, 209,   0,
+      4, 255, 240,   0,  31, 255, 212,
+    // 'S'
+      0,  10, 216, 216, 216, 185,   0,
+      3, 221, 242,  36,  60, 250, 185,
+      4, 255, 240,   0,   3,  28,  23,
+      0,  34, 254, 232, 232, 199,   0,
+      0,   0,  16,  16,  42, 253, 202,
+      3, 244, 228,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // 'T'
+      3, 216, 216, 216, 216, 216, 182,
+      0,  36,  49, 255, 231,  36,  30,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+    // 'U'
+      3, 216, 202,   0,  23, 216, 182,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // 'V'
+      3, 216, 202,   0,  23, 216, 182,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  23, 255, 244, 245, 221,  10,
+      0,   0,  19, 255, 228,   3,   0,
+    // 'W'
+      3, 216, 202,   0,   0,  30, 216, 175,
+      4, 255, 240,   0,   0,  36, 255, 208,
+      4, 255, 240,   0,   0,  36, 255, 208,
+      4, 255, 240,  21, 206,  36, 255, 208,
+      4, 255, 255, 241, 254, 242, 255, 208,
+      4, 255, 255, 233,  38, 255, 255, 208,
+      4, 255, 240,   3,   0,  39, 255, 208,
+    // 'X'
+      3, 216, 202,   0,  23, 216, 182,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  38, 254, 228, 231, 223,  23,
+      0,   1,  38, 255, 230,  20,   0,
+      0,  11, 241, 255, 254, 206,   0,
+      3, 244, 240,  12,  38, 254, 205,
+      4, 255, 240,   0,  28, 255, 216,
+    // 'Y'
+      3, 216, 202,   0,  23, 216, 182,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  34, 254, 232, 234, 223,  20,
+      0,   0,  31, 255, 229,  13,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+    // 'Z'
+      3, 216, 216, 216, 216, 216, 182,
+      0,  36,  36,  36,  60, 255, 216,
+      0,   0,   0,  21, 231, 223,  23,
+      0,   0,  14, 234, 230,  20,   0,
+      0,  11, 241, 233,  14,   0,   0,
+      3, 244, 240,  10,   0,   0,   0,
+      4, 255, 255, 252, 252, 252, 212,
+    // '['
+     10, 216, 216, 216, 185,
+     12, 255, 235,  36,  30,
+     12, 255, 232,   0,   0,
+     12, 255, 232,   0,   0,
+     12, 255, 232,   0,   0,
+     12, 255, 232,   0,   0,
+     12, 255, 255, 252, 216,
+    // '\\'
+      3, 220, 206,   0,   0,   0,   0,   0,
+      0,  38, 254, 206,   0,   0,   0,   0,
+      0,   1,  38, 253, 206,   0,   0,   0,
+      0,   0,   1,  38, 254, 206,   0,   0,
+      0,   0,   0,   1,  38, 254, 205,   0,
+      0,   0,   0,   0,   0,  39, 255, 204,
+    // ']'
+     10, 216, 216, 216, 185,
+      1,  36,  56, 255, 220,
+      0,   0,  24, 255, 220,
+      0,   0,  24, 255, 220,
+      0,   0,  24, 255, 220,
+      0,   0,  24, 255, 220,
+     11, 252, 252, 255, 220,
+    // '^'
+      0,   0,  13, 216, 192,   0,   0,
+      0,  10, 222, 255, 252, 189,   0,
+      3, 229, 255, 255, 255, 252, 192,
+      0,  24,  38, 255, 230,  24,  20,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+    // '_'
+    252, 252, 252, 252, 252, 252, 252, 204,
+    // '`'
+     13, 216, 192,   0,   0,
+      2,  56, 252, 189,   0,
+      0,   2,  52, 252, 192,
+      0,   0,   2,  24,  20,
+    // 'a'
+      0,  10, 228, 228, 228, 195,   0,
+      0,   1,  24,  24,  49, 252, 195,
+      0,  11, 240, 240, 241, 255, 216,
+      3, 244, 240,  12,  38, 255, 216,
+      0,  15, 255, 252, 252, 255, 216,
+    // 'b'
+      3, 220, 206,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 254, 232, 232, 199,   0,
+      4, 255, 241,  16,  42, 253, 202,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 255, 252, 252, 220,   3,
+    // 'c'
+      0,  10, 228, 228, 228, 195,
+      3, 233, 241,  24,  24,  20,
+      4, 255, 240,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,
+      0,  15, 255, 252, 252, 216,
+    // 'd'
+      0,   0,   0,   0,  24, 220, 185,
+      0,   0,   0,   0,  28, 255, 216,
+      0,  10, 232, 232, 234, 255, 216,
+      3, 240, 241,  16,  42, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 255, 216,
+    // 'e'
+      0,  10, 228, 228, 228, 195,   0,
+      3, 233, 241,  24,  49, 252, 195,
+      4, 255, 255, 240, 241, 255, 216,
+      4, 255, 240,  12,  12,  12,  10,
+      0,  15, 255, 252, 252, 216,   0,
+    // 'f'
+      0,   0,  20, 220, 220, 185,
+      0,  14, 230, 231,  28,  23,
+     10, 233, 255, 253, 232, 195,
+      0,  31, 255, 229,  16,  13,
+      0,  16, 255, 228,   0,   0,
+      0,  16, 255, 228,   0,   0,
+    // 'g'
+      0,  10, 228, 228, 228, 228, 192,
+      3, 233, 241,  24,  49, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  23, 255, 244, 245, 255, 216,
+      0,   0,   4,   4,  31, 255, 216,
+    // 'h'
+      3, 216, 202,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 254, 228, 228, 195,   0,
+      4, 255, 241,  24,  49, 252, 195,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+    // 'i'
+      0,  13, 216, 192,   0,
+      0,   2,  36,  32,   0,
+     10, 228, 228, 203,   0,
+      1,  38, 255, 228,   0,
+      0,  16, 255, 228,   0,
+      0,  16, 255, 228,   0,
+     11, 252, 255, 255, 216,
+    // 'j'
+     20, 220, 189,
+      2,  28,  24,
+     21, 232, 199,
+     24, 255, 220,
+     24, 255, 220,
+     24, 255, 220,
+    // 'k'
+      3, 216, 202,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,  21, 232, 199,   0,
+      4, 255, 255, 241, 229,  13,   0,
+      4, 255, 240,  34, 254, 209,   0,
+      4, 255, 240,   0,  31, 255, 212,
+    // 'l'
+     10, 216, 216, 192,   0,
+      1,  49, 255, 228,   0,
+      0,  16, 255, 228,   0,
+      0,  16, 255, 228,   0,
+      0,  16, 255, 228,   0,
+      0,  16, 255, 228,   0,
+     11, 252, 255, 255, 216,
+    // 'm'
+      3, 228, 213,   0,  24, 228, 192,   0,
+      4, 255, 254, 232, 234, 255, 252, 188,
+      4, 255, 255, 255, 255, 255, 255, 208,
+      4, 255, 240,  34, 229,  46, 255, 208,
+      4, 255, 240,   0,   3,  36, 255, 208,
+    // 'n'
+      3, 228, 228, 228, 228, 195,   0,
+      4, 255, 241,  24,  49, 252, 195,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+    // 'o'
+      0,  10, 228, 228, 228, 195,   0,
+      3, 233, 241,  24,  49, 252, 195,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 220,   3,
+    // 'p'
+      3, 228, 228, 228, 228, 195,   0,
+      4, 255, 241,  24,  49, 252, 195,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 255, 244, 245, 221,  10,
+      4, 255, 240,   4,   4,   3,   0,
+    // 'q'
+      0,  10, 228, 228, 228, 228, 192,
+      3, 233, 241,  24,  49, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  23, 255, 244, 245, 255, 216,
+      0,   0,   4,   4,  31, 255, 216,
+    // 'r'
+      3, 228, 228, 228, 228, 195,   0,
+      4, 255, 241,  24,  49, 252, 195,
+      4, 255, 240,   0,   1,  16,  13,
+      4, 255, 240,   0,   0,   0,   0,
+      4, 255, 240,   0,   0,   0,   0,
+    // 's'
+      0,  10, 228, 228, 228, 228, 192,
+      3, 233, 241,  24,  24,  24,  20,
+      0,  27, 255, 240, 240, 206,   0,
+      0,   0,  12,  12,  38, 254, 205,
+      3, 252, 252, 252, 252, 220,   3,
+    // 't'
+      0,   0,  13, 220, 195,   0,   0,
+      3, 228, 229, 255, 252, 228, 192,
+      0,  24,  38, 255, 230,  24,  20,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,   0,  27, 255, 252, 212,
+    // 'u'
+      3, 228, 213,   0,  24, 228, 192,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  15, 255, 252, 252, 255, 216,
+    // 'v'
+      3, 228, 213,   0,  24, 228, 192,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  23, 255, 244, 245, 221,  10,
+      0,   0,  19, 255, 228,   3,   0,
+    // 'w'
+      3, 228, 213,   0,   0,  32, 228, 185,
+      4, 255, 240,  21, 206,  36, 255, 208,
+      4, 255, 255, 241, 254, 242, 255, 208,
+      0,  23, 255, 255, 255, 255, 217,   9,
+      0,  12, 255, 232,  31, 255, 216,   0,
+    // 'x'
+      3, 228, 213,   0,  24, 228, 192,
+      0,  34, 254, 232, 234, 223,  20,
+      0,   0,  31, 255, 229,  13,   0,
+      0,  11, 244, 255, 254, 209,   0,
+      3, 252, 240,   4,  31, 255, 212,
+    // 'y'
+      3, 228, 213,   0,  24, 228, 192,
+      4, 255, 240,   0,  28, 255, 216,
+      4, 255, 240,   0,  28, 255, 216,
+      0,  23, 255, 244, 245, 255, 216,
+      0,   0,   4,  27, 255, 220,   3,
+    // 'z'
+      3, 228, 228, 228, 228, 228, 192,
+      0,  24,  24,  45, 255, 223,  20,
+      0,   0,  15, 241, 229,  13,   0,
+      0,  11, 244, 233,  10,   0,   0,
+      3, 252, 255, 255, 252, 252, 212,
+    // '{'
+      0,   0,   0,  20, 216, 216, 182,
+      0,   0,  13, 223, 231,  36,  30,
+      0,   0,  16, 255, 228,   0,   0,
+      3, 232, 233, 234,  21,   0,   0,
+      0,  16,  31, 254, 213,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,   0,  27, 255, 252, 212,
+    // '|'
+     13, 216, 192,
+     16, 255, 228,
+     16, 255, 228,
+     16, 255, 228,
+     16, 255, 228,
+     16, 255, 228,
+     16, 255, 228,
+    // '}'
+      3, 216, 216, 195,   0,   0,   0,
+      0,  36,  49, 252, 195,   0,   0,
+      0,   0,  16, 255, 228,   0,   0,
+      0,   0,   1,  45, 253, 232, 195,
+      0,   0,  15, 241, 229,  16,  13,
+      0,   0,  16, 255, 228,   0,   0,
+      3, 252, 252, 232,   3,   0,   0,
+    // '~'
+      3, 216, 216, 195,   0,  30, 182,
+      4, 255, 255, 252, 220, 225, 216,
+      4, 245,  42, 255, 255, 223,  23,
+      0,  22,   1,  24,  24,  20,   0,
+};
+
+constexpr BakedFont c64Fonts[] = {
+    { 20, c64Glyphs20, c64Coverage20 },
+    { 10, c64Glyphs10, c64Coverage10 },
+};
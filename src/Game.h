@@ -0,0 +1,149 @@
+// Interface between the game and the platform backends (PlatformWeb.cpp, PlatformLinux.cpp)
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr int GAME_WIDTH = 569;
+constexpr int GAME_HEIGHT = 388;
+// length of a simulation tick, a whole number of milliseconds keeps the simulation time exact
+constexpr float SIM_TICK_MS = 8.f;
+
+// the keys the game reacts to
+enum Key : uint8_t
+{
+    KEY_ENTER,
+    KEY_SPACE,
+    KEY_UP,
+    KEY_DOWN,
+    KEY_LEFT,
+    KEY_RIGHT,
+    KEY_R,
+    KEY_P, // profiler overlay
+    KEY_BACKSPACE, // rewind
+    KEY_NUM_KEYS
+};
+
+enum TouchEventType
+{
+    TOUCH_START,
+    TOUCH_MOVE,
+    TOUCH_END,
+    TOUCH_CANCEL
+};
+
+// Call once the GL context is current
+void init_game();
+// Runs the simulation ticks due at time t (ms) and renders the frame
+void game_frame(double t);
+// Advances the simulation by one fixed tick, without rendering
+void simulate_tick();
+// simulate_tick() with a step of dt ms, for testing the game at the steps of a slow device. The game itself always
+// steps SIM_TICK_MS.
+void simulate_step(float dt);
+void render_scene(float alpha);
+// render_scene() if the frame has changed, what game_frame() draws with
+void render_frame(float alpha);
+
+// The title and end screens only wait for input and are static: game_frame() draws them when they have changed
+// and skips the other frames. While the scene is static the platform may call game_frame() less often, as long as
+// it calls it promptly after input.
+bool is_scene_static();
+// The platform has lost the picture, e.g. the canvas was resized, the next frame is drawn
+void invalidate_frame();
+struct FrameStats
+{
+    uint64_t rendered, skipped;
+};
+FrameStats frame_stats();
+
+// With -DBATCHASE_SIM_THREAD the simulation can run on its own thread, game_frame() then only draws the latest
+// tick the thread has finished. speed: simulated ms per ms, 0 ticks as fast as possible. The times of the input
+// events are only on the simulation's clock at speed 1, faster runs pass t = 0.
+void start_simulation_thread(double speed = 1.0);
+void stop_simulation_thread();
+uint64_t num_simulated_ticks();
+// the clock the simulation thread keeps time by, game_frame() must be given its times to interpolate between the ticks
+double now_ms();
+// the tick of the snapshot the latest game_frame() drew, for the thread that calls it
+uint64_t shown_tick();
+
+// Input events, t is the time of the event (ms) on the clock of game_frame(). They take effect on the tick that
+// t falls in, t = 0 applies them on the next simulate_tick().
+void key_event(Key key, bool down, double t = 0.0);
+void touch_event(TouchEventType type, double t = 0.0);
+
+// The gameplay state is saved every second into a ring of snapshots, for rewinding. age 0 is the newest,
+// restore_game_snapshot() returns its simulation time (ms). Restoring doesn't remove the newer snapshots, ticking
+// on from an older one adds the next snapshot after the newest.
+bool take_game_snapshot(); // false if the world is bigger than a snapshot holds
+double restore_game_snapshot(size_t age);
+size_t num_game_snapshots();
+size_t game_snapshots_memory(); // bytes
+
+// seed of the next game
+extern uint64_t gameSeed;
+extern float score, highscore;
+extern int lives;
+// contacts between the player and a car in the current game, counted when they start
+extern int playerCollisions;
+
+// The tuning of the traffic and the player, can be changed between games
+struct Difficulty
+{
+    float playerMaxVelx = 0.55f;
+    // the cars cruise at random speeds between the min and max velx, and change lanes at enemyMaxVely
+    float enemyMinVelx = 0.15f, enemyMaxVelx = 0.45f, enemyMaxVely = 0.07f;
+    // entities on the road at most, with the road and the player: baseMaxObjects + score / scorePerObject
+    float baseMaxObjects = 15.f, scorePerObject = 10000.f;
+    // the distance to the next car is random(0, min(maxSpawnInterval, minSpawnInterval + spawnIntervalScale / score))
+    float minSpawnInterval = 25.f, maxSpawnInterval = 2500.f, spawnIntervalScale = 22000000.f;
+};
+extern Difficulty difficulty;
+
+// for the benchmarks
+extern bool godMode; // collisions don't cost lives
+extern bool useSimd; // SIMD kernels for moving and colliding the cars, when the target has them
+void EnterGame();
+void spawn_enemy(float x);
+struct CarState
+{
+    float x, y, velx, vely;
+};
+// a car of the first kind, for the collision tests
+void spawn_enemy(const CarState& car);
+// entity is an index below num_entities(), the entities are in the order they were created until one is removed
+CarState get_car_state(size_t entity);
+// puts the entity back where get_car_state() found it, the collision pass changes nothing else of the cars
+void set_car_state(size_t entity, const CarState& car);
+// the collision pass of update_game()
+bool collide_cars();
+// the traffic AI pass of update_game()
+void update_traffic(float dt);
+size_t num_collision_pairs();
+// pair n of the latest collision pass, n < num_collision_pairs(): the entity indices of the two cars, higher first
+void get_collision_pair(size_t n, int& first, int& second);
+// The broad phase tests every pair of cars of the world instead of sweeping, the O(n^2) reference for checking the
+// sweep. The pairs come in the order the sweep finds them.
+extern bool bruteForcePairs;
+size_t num_entities();
+
+// counters of the latest render_scene()
+struct RenderStats
+{
+    int drawCalls;
+    int sprites; // drawn
+    int culled; // sprites outside the screen, not drawn
+    int particlesCulled; // the same of the sparks and the smoke
+    float overdraw; // pixels drawn per pixel of the screen
+};
+RenderStats last_render_stats();
+
+// the textures the renderer has allocated
+struct TextureMemory
+{
+    size_t bytes;
+    // what they took when the sprites were RGBA: the atlas and the sprites outside it at 4 bytes a pixel, no palette
+    size_t rgbaSpritesBytes;
+};
+TextureMemory texture_memory();
@@ -0,0 +1,259 @@
+// Runs the game without a window, as fast as the simulation goes, for profiling with native tools:
+//   build/BatChaseHeadless --ticks 1000000 --seed 1
+// A simple bot starts the games and plays them: it keeps accelerating and swerves up and down at random.
+// --threaded runs the simulation on its own thread at THREADED_SPEED times real time while this one draws its
+// snapshots as fast as it can, build with -fsanitize=thread to check the hand-over between them. It fails if too few
+// games were played to have gone through their ends and starts.
+// --check-allocations fails if the ticks or frames allocate from the heap once the first games have warmed up.
+// --golden DIR renders a frame every GOLDEN_INTERVAL ticks with the software rasterizer (SoftGL.h) and fails if it
+// differs from DIR/tick-N.png, which --update-golden writes instead. A frame that differs is written next to it as
+// tick-N-actual.png.
+#include "Game.h"
+#include "Platform.h"
+#include "SoftGL.h"
+
+#include <png.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::atomic<uint64_t> allocations;
+
+void* operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// ticks before --check-allocations starts counting, a few games in
+constexpr long long ALLOCATION_WARMUP_TICKS = 10000;
+// a frame every 40 s of play
+constexpr long long GOLDEN_INTERVAL = 5000;
+// --threaded plays at this many times real time, slow enough for the bot to see every game and fast enough to play
+// a few a second
+constexpr double THREADED_SPEED = 50.0;
+// --threaded fails with fewer games over than one per this many ticks, the hand-over at the end and start of the
+// games wouldn't have been exercised
+constexpr long long THREADED_TICKS_PER_GAME = 5000;
+
+// pixels: the frame of the software rasterizer, bottom row first
+bool write_png(const std::string& path, const uint8_t* pixels)
+{
+    png_image image{};
+    image.version = PNG_IMAGE_VERSION;
+    image.width = GAME_WIDTH;
+    image.height = GAME_HEIGHT;
+    image.format = PNG_FORMAT_RGBA;
+    return png_image_write_to_file(&image, path.c_str(), 0, pixels, -GAME_WIDTH * 4, nullptr);
+}
+
+// Returns the number of pixels that differ from the image in path, -1 if it can't be read or is of another size
+long compare_png(const std::string& path, const uint8_t* pixels)
+{
+    png_image image{};
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str()))
+        return -1;
+    image.format = PNG_FORMAT_RGBA;
+    std::vector<uint8_t> golden(PNG_IMAGE_SIZE(image));
+    if (image.width != GAME_WIDTH || image.height != GAME_HEIGHT ||
+        !png_image_finish_read(&image, nullptr, golden.data(), -GAME_WIDTH * 4, nullptr))
+        return -1;
+    long different = 0;
+    for(size_t i = 0; i < golden.size(); i += 4)
+        different += std::memcmp(&golden[i], pixels + i, 4) != 0;
+    return different;
+}
+
+int main(int argc, char** argv)
+{
+    long long ticks = 100000;
+    uint64_t seed = 1;
+    bool render = false, rushHour = false, threaded = false, checkAllocations = false, updateGolden = false;
+    const char* goldenDirectory = nullptr;
+    for(int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--ticks") && i + 1 < argc)
+            ticks = std::atoll(argv[++i]);
+        else if (!std::strcmp(argv[i], "--seed") && i + 1 < argc)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--assets") && i + 1 < argc)
+            assetDirectory = argv[++i];
+        else if (!std::strcmp(argv[i], "--render"))
+            render = true;
+        else if (!std::strcmp(argv[i], "--rush-hour"))
+            rushHour = true;
+        else if (!std::strcmp(argv[i], "--check-allocations"))
+            checkAllocations = true;
+        else if (!std::strcmp(argv[i], "--golden") && i + 1 < argc)
+            goldenDirectory = argv[++i];
+        else if (!std::strcmp(argv[i], "--update-golden"))
+            updateGolden = true;
+#ifdef BATCHASE_SIM_THREAD
+        else if (!std::strcmp(argv[i], "--threaded"))
+            threaded = true;
+#endif
+        else
+        {
+            std::printf("usage: %s [--ticks N] [--seed N] [--assets DIR] [--render] [--rush-hour] [--threaded]\n"
+                "    [--check-allocations] [--golden DIR [--update-golden]]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (goldenDirectory && threaded)
+    {
+        std::printf("--golden needs the ticks in step with the frames, without --threaded\n");
+        return 1;
+    }
+
+    if (goldenDirectory)
+    {
+        soft_gl_init(GAME_WIDTH, GAME_HEIGHT);
+        soft_gl_set_threads(std::thread::hardware_concurrency());
+    }
+    init_game();
+    gameSeed = seed;
+    if (rushHour)
+    {
+        key_event(KEY_R, true);
+        simulate_tick();
+        key_event(KEY_R, false);
+    }
+
+    std::mt19937 bot(seed);
+    int gamesOver = 0, goldenFrames = 0, goldenFailures = 0;
+    uint64_t allocationsBefore = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto elapsedMs = [&start] { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+#ifdef BATCHASE_SIM_THREAD
+    if (threaded)
+    {
+        // The input can't be in step with the ticks, the bot plays what it sees: it acts whenever a frame shows a
+        // snapshot at least 50 ticks after the one it last acted on, and a game is over when a frame shows the end
+        // screen after a game.
+        start_simulation_thread(THREADED_SPEED);
+        uint64_t prevTick = 0;
+        bool enter = false, playing = false;
+        while (num_simulated_ticks() < (uint64_t)ticks)
+        {
+            // on the simulation thread's clock, so that the frames interpolate between its ticks
+            game_frame(now_ms());
+            const uint64_t tick = shown_tick();
+            if (tick < prevTick + 50)
+                continue;
+            prevTick = tick;
+            // the title and end screens are the static ones, Enter leaves them and does nothing during a game
+            const bool staticScene = is_scene_static();
+            if (playing && staticScene)
+                ++gamesOver;
+            playing = !staticScene;
+            enter = staticScene && !enter;
+            key_event(KEY_ENTER, enter);
+            key_event(KEY_RIGHT, true);
+            int steer = bot() % 3;
+            key_event(KEY_UP, steer == 1);
+            key_event(KEY_DOWN, steer == 2);
+        }
+        stop_simulation_thread();
+        ticks = num_simulated_ticks();
+    }
+#endif
+    for(long long tick = 0; tick < ticks && !threaded; ++tick)
+    {
+        if (tick == ALLOCATION_WARMUP_TICKS)
+            allocationsBefore = allocations;
+        // Enter leaves the title and end screens, it does nothing during a game
+        key_event(KEY_ENTER, tick % 500 == 0);
+        key_event(KEY_RIGHT, true);
+        if (tick % 50 == 0)
+        {
+            int steer = bot() % 3;
+            key_event(KEY_UP, steer == 1);
+            key_event(KEY_DOWN, steer == 2);
+        }
+
+        int livesBefore = lives;
+        simulate_tick();
+        if (livesBefore > 0 && lives <= 0)
+            ++gamesOver;
+
+        // a 60 Hz display renders about every other tick
+        if (render && tick % 2 == 0)
+            render_frame(0.f);
+
+        if (goldenDirectory && (tick + 1) % GOLDEN_INTERVAL == 0)
+        {
+            render_scene(0.f);
+            const std::string path = std::string(goldenDirectory) + "/tick-" + std::to_string(tick + 1);
+            ++goldenFrames;
+            if (updateGolden)
+            {
+                if (!write_png(path + ".png", soft_gl_pixels()))
+                {
+                    std::fprintf(stderr, "Cannot write %s.png\n", path.c_str());
+                    ++goldenFailures;
+                }
+                continue;
+            }
+            const long different = compare_png(path + ".png", soft_gl_pixels());
+            if (different == 0)
+                continue;
+            ++goldenFailures;
+            if (different < 0)
+                std::fprintf(stderr, "Cannot read %s.png\n", path.c_str());
+            else
+                std::fprintf(stderr, "%s.png: %ld pixels differ\n", path.c_str(), different);
+            write_png(path + "-actual.png", soft_gl_pixels());
+        }
+    }
+    double wallMs = elapsedMs();
+
+    double simMs = ticks * (double)SIM_TICK_MS;
+    std::printf("%lld ticks (%.1f s simulated) in %.1f ms: %.0f ticks/s, %.0fx real time\n",
+        ticks, simMs / 1000.0, wallMs, ticks / wallMs * 1000.0, simMs / wallMs);
+    std::printf("games over: %d, high score: %d\n", gamesOver, (int)highscore / 10 * 10);
+    if (const FrameStats frames = frame_stats(); frames.rendered + frames.skipped > 0)
+        std::printf("frames rendered: %llu, skipped on the static screens: %llu\n",
+            (unsigned long long)frames.rendered, (unsigned long long)frames.skipped);
+    const TextureMemory textures = texture_memory();
+    std::printf("texture memory: %zu bytes, %zu with RGBA sprites\n", textures.bytes, textures.rgbaSpritesBytes);
+
+    if (threaded && gamesOver < ticks / THREADED_TICKS_PER_GAME)
+    {
+        std::printf("only %d games over in %lld ticks, expected at least %lld\n", gamesOver, ticks, ticks / THREADED_TICKS_PER_GAME);
+        return 1;
+    }
+
+    if (goldenDirectory)
+    {
+        std::printf("golden frames %s: %d, failed: %d\n", updateGolden ? "written" : "compared", goldenFrames, goldenFailures);
+        if (goldenFailures > 0)
+            return 1;
+    }
+
+    if (checkAllocations)
+    {
+        if (threaded || ticks <= ALLOCATION_WARMUP_TICKS)
+        {
+            std::printf("--check-allocations needs more than %lld ticks without --threaded\n", ALLOCATION_WARMUP_TICKS);
+            return 1;
+        }
+        const uint64_t steadyAllocations = allocations - allocationsBefore;
+        std::printf("heap allocations after the warm-up: %llu\n", (unsigned long long)steadyAllocations);
+        if (steadyAllocations > 0)
+            return 1;
+    }
+}
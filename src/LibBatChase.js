@@ -1,75 +1,351 @@
 mergeInto(LibraryManager.library, {
-    upload_flipped: function (img) {
-        const GL_UNPACK_FLIP_Y_WEBGL = 0x9240;
-        const GL_TEXTURE_2D = 0xDE1;
-        const GL_RGBA = 0x1908;
-        const GL_UNSIGNED_BYTE = 0x1401;
+    // Images decoded to indices and their palette (see decoded_image_size() in src/Platform.h), by image id
+    images: { decoded: {} },
+    // Decodes a PNG to { width, height, colors, indices, palette }: one index per pixel, top row first, and colors
+    // RGBA colours. Palette PNGs are read as they are, the others are drawn to a canvas and their colours collected.
+    decode_png: async function (bytes) {
+        const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+        const width = view.getUint32(16), height = view.getUint32(20), depth = bytes[24], colorType = bytes[25];
+        if (colorType != 3 || bytes[28] != 0) {
+            const bitmap = await createImageBitmap(new Blob([bytes], { type: 'image/png' }));
+            const context = new OffscreenCanvas(width, height).getContext('2d');
+            context.drawImage(bitmap, 0, 0);
+            const rgba = new Uint32Array(context.getImageData(0, 0, width, height).data.buffer);
+            let indices = new Uint8Array(width * height), colors = new Map();
+            for (let i = 0; i < rgba.length; ++i) {
+                let index = colors.get(rgba[i]);
+                if (index === undefined) {
+                    if (colors.size == 256)
+                        throw new Error('more than 256 colours');
+                    colors.set(rgba[i], index = colors.size);
+                }
+                indices[i] = index;
+            }
+            return { width: width, height: height, colors: colors.size, indices: indices, palette: new Uint8Array(new Uint32Array([...colors.keys()]).buffer) };
+        }
 
-        GLctx.pixelStorei(GL_UNPACK_FLIP_Y_WEBGL, true);
-        GLctx.texImage2D(GL_TEXTURE_2D, 0, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, img);
-        GLctx.pixelStorei(GL_UNPACK_FLIP_Y_WEBGL, false);
-    },
-    load_image__deps: ['upload_flipped'],
-    load_image: function (glTex, url, outWidth, outHeight) {
-        let img = new Image();
-        img.onload = () => {
-            const GL_TEXTURE_2D = 0xDE1;
+        let palette = new Uint8Array(256 * 4), colors = 0, chunks = [];
+        for (let p = 8; p < bytes.length;) {
+            const length = view.getUint32(p), type = String.fromCharCode(...bytes.subarray(p + 4, p + 8));
+            const data = bytes.subarray(p + 8, p + 8 + length);
+            if (type == 'PLTE') {
+                colors = length / 3;
+                for (let i = 0; i < colors; ++i)
+                    palette.set([data[3 * i], data[3 * i + 1], data[3 * i + 2], 255], 4 * i);
+            }
+            else if (type == 'tRNS')
+                data.forEach((alpha, i) => palette[4 * i + 3] = alpha);
+            else if (type == 'IDAT')
+                chunks.push(data);
+            p += 12 + length;
+        }
+        const stream = new Blob(chunks).stream().pipeThrough(new DecompressionStream('deflate'));
+        const filtered = new Uint8Array(await new Response(stream).arrayBuffer());
 
-            HEAPU32[outWidth >> 2] = img.width;
-            HEAPU32[outHeight >> 2] = img.height;
-            GLctx.bindTexture(GL_TEXTURE_2D, GL.textures[glTex]);
-            _upload_flipped(img);
-        };
-        img.src = UTF8ToString(url);
+        // undo the filters, a byte at a time at depths up to 8
+        const stride = (width * depth + 7) >> 3;
+        let rows = new Uint8Array(stride * height);
+        for (let y = 0; y < height; ++y) {
+            const filter = filtered[y * (stride + 1)], src = y * (stride + 1) + 1, row = y * stride, up = row - stride;
+            for (let x = 0; x < stride; ++x) {
+                const a = x > 0 ? rows[row + x - 1] : 0, b = y > 0 ? rows[up + x] : 0, c = x > 0 && y > 0 ? rows[up + x - 1] : 0;
+                let predicted = 0;
+                if (filter == 1) predicted = a;
+                else if (filter == 2) predicted = b;
+                else if (filter == 3) predicted = (a + b) >> 1;
+                else if (filter == 4) {
+                    const pa = Math.abs(b - c), pb = Math.abs(a - c), pc = Math.abs(a + b - 2 * c);
+                    predicted = pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+                }
+                rows[row + x] = filtered[src + x] + predicted;
+            }
+        }
+        let indices = rows;
+        if (depth < 8) {
+            indices = new Uint8Array(width * height);
+            const perByte = 8 / depth, mask = (1 << depth) - 1;
+            for (let y = 0; y < height; ++y)
+                for (let x = 0; x < width; ++x)
+                    indices[y * width + x] = rows[y * stride + Math.floor(x / perByte)] >> (8 - depth * (x % perByte + 1)) & mask;
+        }
+        return { width: width, height: height, colors: colors, indices: indices, palette: palette };
     },
-    preloaded_audio: {},
-    preload_audio__deps: ['preloaded_audio'],
-    preload_audio: function (id, url) {
-        let audio = new Audio(UTF8ToString(url));
-        // TODO hardcoded lower volume
-        audio.volume = 0.5;
-        _preloaded_audio[id] = audio;
-        audio.preload = 'auto';
+    load_image__deps: ['images', 'decode_png'],
+    load_image: function (id, url) {
+        url = UTF8ToString(url);
+        fetch(url)
+            .then(response => response.arrayBuffer())
+            .then(data => _decode_png(new Uint8Array(data)))
+            .then(image => _images.decoded[id] = image)
+            .catch(e => console.error(`Cannot load ${url}: ${e}`));
+    },
+    decoded_image_size__deps: ['images'],
+    decoded_image_size: function (id, width, height, colors) {
+        const image = _images.decoded[id];
+        if (!image)
+            return 0;
+        HEAP32[width >> 2] = image.width;
+        HEAP32[height >> 2] = image.height;
+        HEAP32[colors >> 2] = image.colors;
+        return 1;
     },
-    play_audio: function (id, loop) {
-        let audio = _preloaded_audio[id];
-        audio.loop = !!loop;
-        audio.play()
-            .catch(e => {
-                let deferPlay = () => {
-                    audio.play()
-                        .then(() => {
-                            document.body.removeEventListener('keydown', deferPlay);
-                        });
-                };
+    copy_decoded_image__deps: ['images'],
+    copy_decoded_image: function (id, indices, palette) {
+        const image = _images.decoded[id];
+        HEAPU8.set(image.indices, indices);
+        HEAPU8.set(image.palette.subarray(0, image.colors * 4), palette);
+        delete _images.decoded[id];
+    },
+    // State of the asset bundle made by src/Packer.cpp, see src/Bundle.h for the layout
+    bundle: { progress: 0, entries: null },
+    bundle_set_ready__deps: ['bundle'],
+    bundle_set_ready: function (entry) {
+        // BundleProgress::entryReady
+        HEAPU8[_bundle.progress + 12 + entry] = 1;
+    },
+    // Resolves to { entry, data, mime } of a file in the bundle, rejects if the bundle doesn't have it
+    bundle_file__deps: ['bundle'],
+    bundle_file: function (name) {
+        if (!_bundle.entries)
+            return Promise.reject();
+        return _bundle.entries.then(entries => entries.get(name) || Promise.reject());
+    },
+    ima_step_table: [
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+        107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+        876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871,
+        5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623,
+        27086, 29794, 32767
+    ],
+    // Decodes the IMA ADPCM of the packer into a 16-bit PCM wav
+    decode_ima_adpcm__deps: ['ima_step_table'],
+    decode_ima_adpcm: function (data, sampleRate, channels, frames) {
+        const indexTable = [-1, -1, -1, -1, 2, 4, 6, 8];
+        const wav = new DataView(new ArrayBuffer(44 + frames * channels * 2));
+        const header = [0x46464952, 36 + frames * channels * 2, 0x45564157, 0x20746d66, 16];
+        header.forEach((value, i) => wav.setUint32(i * 4, value, true));
+        wav.setUint16(20, 1, true); // PCM
+        wav.setUint16(22, channels, true);
+        wav.setUint32(24, sampleRate, true);
+        wav.setUint32(28, sampleRate * channels * 2, true);
+        wav.setUint16(32, channels * 2, true);
+        wav.setUint16(34, 16, true);
+        wav.setUint32(36, 0x61746164, true);
+        wav.setUint32(40, frames * channels * 2, true);
 
-                document.body.addEventListener('keydown', deferPlay);
-            });
+        const bytesPerChannel = (frames + 1) >> 1;
+        for (let c = 0; c < channels; ++c) {
+            let predictor = 0, index = 0;
+            for (let i = 0; i < frames; ++i) {
+                const byte = data[c * bytesPerChannel + (i >> 1)];
+                const code = i & 1 ? byte >> 4 : byte & 15;
+                const step = _ima_step_table[index];
+                let delta = step >> 3;
+                if (code & 4) delta += step;
+                if (code & 2) delta += step >> 1;
+                if (code & 1) delta += step >> 2;
+                predictor = Math.max(-32768, Math.min(32767, code & 8 ? predictor - delta : predictor + delta));
+                index = Math.max(0, Math.min(88, index + indexTable[code & 7]));
+                wav.setInt16(44 + (i * channels + c) * 2, predictor, true);
+            }
+        }
+        return new Uint8Array(wav.buffer);
     },
-    loadedFonts: {},
-    load_font__deps: ['loadedFonts'],
-    load_font: function (fontId, url) {
-        new FontFace(`font${fontId}`, `url(${UTF8ToString(url)})`).load().then(face => {
-            document.fonts.add(face);
-            _loadedFonts[`font${fontId}`] = 1;
+    // Streams the bundle and decodes each entry as soon as its bytes have arrived
+    load_bundle__deps: ['bundle', 'bundle_set_ready', 'decode_ima_adpcm', 'images', 'decode_png'],
+    load_bundle: function (url, indexPtr, progressPtr) {
+        const BUNDLE_MAGIC = 0x31434342, ENTRY_SIZE = 52, MAX_ENTRIES = 64;
+        const BUNDLE_FILE = 0, BUNDLE_ATLAS = 1, BUNDLE_IMA_ADPCM = 3;
+        const BUNDLE_INDEX_READY = 1, BUNDLE_DONE = 2, BUNDLE_FAILED = 3;
+        const mimeTypes = { mp3: 'audio/mpeg', wav: 'audio/wav' };
+        url = UTF8ToString(url);
+        _bundle.progress = progressPtr;
+
+        let resolveEntries, rejectEntries;
+        _bundle.entries = new Promise((resolve, reject) => { resolveEntries = resolve; rejectEntries = reject; });
+        _bundle.entries.catch(() => {}); // the assets fall back to their own files
+
+        const decode = (i, entry, data) => {
+            if (entry.type == BUNDLE_ATLAS) {
+                // bundle_image_id()
+                _decode_png(data)
+                    .then(image => {
+                        _images.decoded[-1 - i] = image;
+                        _bundle_set_ready(i);
+                    })
+                    .catch(e => console.error(`Cannot decode ${entry.name}: ${e}`));
+            }
+            else if (entry.type == BUNDLE_FILE)
+                entry.resolve({ entry: i, data: data, mime: mimeTypes[entry.name.split('.').pop()] || '' });
+            else if (entry.type == BUNDLE_IMA_ADPCM)
+                entry.resolve({ entry: i, data: _decode_ima_adpcm(data, entry.params[0], entry.params[1], entry.params[2]), mime: 'audio/wav' });
+        };
+
+        (async () => {
+            const response = await fetch(url);
+            if (!response.ok)
+                throw new Error(response.status);
+            const total = +response.headers.get('Content-Length') || 0;
+            HEAPU32[(progressPtr >> 2) + 1] = total;
+
+            let bytes = new Uint8Array(total || 1 << 20), length = 0;
+            let entries = null, next = 0;
+            const reader = response.body.getReader();
+            for (;;) {
+                const { done, value } = await reader.read();
+                if (done)
+                    break;
+                if (length + value.length > bytes.length) {
+                    let grown = new Uint8Array(Math.max(bytes.length * 2, length + value.length));
+                    grown.set(bytes.subarray(0, length));
+                    bytes = grown;
+                }
+                bytes.set(value, length);
+                length += value.length;
+                HEAPU32[progressPtr >> 2] = length;
+
+                const view = new DataView(bytes.buffer);
+                if (!entries && length >= 8) {
+                    const numEntries = view.getUint32(4, true);
+                    if (view.getUint32(0, true) != BUNDLE_MAGIC || numEntries > MAX_ENTRIES)
+                        throw new Error('not a bundle');
+                    const indexSize = 8 + numEntries * ENTRY_SIZE;
+                    if (length >= indexSize) {
+                        HEAPU8.set(bytes.subarray(0, indexSize), indexPtr);
+                        entries = [];
+                        let byName = new Map();
+                        for (let i = 0; i < numEntries; ++i) {
+                            const p = 8 + i * ENTRY_SIZE;
+                            const nameBytes = bytes.subarray(p, p + 24);
+                            let entry = {
+                                name: String.fromCharCode(...nameBytes.subarray(0, nameBytes.indexOf(0))),
+                                type: view.getUint32(p + 24, true),
+                                offset: view.getUint32(p + 28, true),
+                                size: view.getUint32(p + 32, true),
+                                params: [view.getUint32(p + 36, true), view.getUint32(p + 40, true), view.getUint32(p + 44, true)],
+                            };
+                            byName.set(entry.name, new Promise(resolve => entry.resolve = resolve));
+                            entries.push(entry);
+                        }
+                        resolveEntries(byName);
+                        HEAP32[(progressPtr >> 2) + 2] = BUNDLE_INDEX_READY;
+                    }
+                }
+                for (; entries && next < entries.length && entries[next].offset + entries[next].size <= length; ++next)
+                    decode(next, entries[next], bytes.slice(entries[next].offset, entries[next].offset + entries[next].size));
+            }
+            if (!entries || next < entries.length)
+                throw new Error('truncated');
+            HEAP32[(progressPtr >> 2) + 2] = BUNDLE_DONE;
+        })().catch(e => {
+            console.error(`Cannot load ${url}: ${e}`);
+            HEAP32[(progressPtr >> 2) + 2] = BUNDLE_FAILED;
+            rejectEntries(e);
         });
     },
-    upload_unicode_char_to_texture__deps: ['upload_flipped'],
-    upload_unicode_char_to_texture: function (fontId, unicodeChar, fontSize) {
-        if (!_loadedFonts[`font${fontId}`])
+    // Web Audio output: the C++ mixer (Mixer.cpp) renders a little ahead of playback and the frames are
+    // posted to an AudioWorklet that plays them from a ring buffer.
+    audio: { context: null, node: null, framesWritten: 0, decoded: {} },
+    audio_context__deps: ['audio'],
+    audio_context: function () {
+        if (!_audio.context) {
+            _audio.context = new AudioContext({ latencyHint: 'interactive' });
+            // browsers keep the context suspended until the user interacts with the page
+            const resume = () => _audio.context.resume();
+            ['keydown', 'touchstart', 'pointerdown'].forEach(type => document.addEventListener(type, resume));
+        }
+        return _audio.context;
+    },
+    init_audio_output__deps: ['audio', 'audio_context'],
+    init_audio_output: function () {
+        const processor = `
+            class RingBufferPlayer extends AudioWorkletProcessor {
+                constructor() {
+                    super();
+                    this.ring = [new Float32Array(32768), new Float32Array(32768)];
+                    this.read = 0;
+                    this.write = 0;
+                    this.port.onmessage = e => {
+                        const [left, right] = e.data;
+                        for (let i = 0; i < left.length; ++i) {
+                            this.ring[0][this.write] = left[i];
+                            this.ring[1][this.write] = right[i];
+                            this.write = (this.write + 1) % this.ring[0].length;
+                        }
+                    };
+                }
+                process(inputs, outputs) {
+                    const out = outputs[0];
+                    for (let i = 0; i < out[0].length; ++i) {
+                        // silence if the main thread hasn't kept up
+                        if (this.read == this.write) {
+                            out[0][i] = out[1][i] = 0;
+                            continue;
+                        }
+                        out[0][i] = this.ring[0][this.read];
+                        out[1][i] = this.ring[1][this.read];
+                        this.read = (this.read + 1) % this.ring[0].length;
+                    }
+                    return true;
+                }
+            }
+            registerProcessor('ring-buffer-player', RingBufferPlayer);`;
+        const context = _audio_context();
+        context.audioWorklet.addModule(URL.createObjectURL(new Blob([processor], { type: 'application/javascript' })))
+            .then(() => {
+                _audio.node = new AudioWorkletNode(context, 'ring-buffer-player', { outputChannelCount: [2] });
+                _audio.node.connect(context.destination);
+            })
+            .catch(e => console.error(`No audio: ${e}`));
+        return context.sampleRate;
+    },
+    audio_frames_needed__deps: ['audio'],
+    audio_frames_needed: function (leadMs) {
+        const context = _audio.context;
+        if (!_audio.node || context.state != 'running')
             return 0;
-        let canvas = document.createElement('canvas');
-        canvas.width = canvas.height = fontSize;
-        let ctx = canvas.getContext('2d');
-        ctx.fillStyle = 'black';
-        ctx.globalCompositeOperator = 'copy';
-        ctx.globalAlpha = 0;
-        ctx.fillRect(0, 0, canvas.width, canvas.height);
-        ctx.globalAlpha = 1;
-        ctx.fillStyle = 'white';
-        ctx.font = fontSize + `px font${fontId}`;
-        ctx.fillText(String.fromCharCode(unicodeChar), 0, canvas.height);
-        _upload_flipped(canvas);
-        return 1;
+        const lead = Math.ceil(context.sampleRate * leadMs / 1000);
+        const played = Math.floor(context.currentTime * context.sampleRate);
+        _audio.framesWritten = Math.max(_audio.framesWritten, played);
+        return Math.max(0, played + lead - _audio.framesWritten);
+    },
+    submit_audio__deps: ['audio'],
+    submit_audio: function (left, right, frames) {
+        const l = HEAPF32.slice(left >> 2, (left >> 2) + frames);
+        const r = HEAPF32.slice(right >> 2, (right >> 2) + frames);
+        _audio.node.port.postMessage([l, r], [l.buffer, r.buffer]);
+        _audio.framesWritten += frames;
+    },
+    preload_audio__deps: ['audio', 'audio_context', 'bundle_file', 'bundle_set_ready'],
+    preload_audio: function (id, url) {
+        url = UTF8ToString(url);
+        _bundle_file(url)
+            .then(file => {
+                _bundle_set_ready(file.entry);
+                return file.data.buffer;
+            }, () => fetch(url).then(response => response.arrayBuffer()))
+            .then(data => _audio_context().decodeAudioData(data))
+            .then(buffer => _audio.decoded[id] = buffer)
+            .catch(e => console.error(`Cannot load ${url}: ${e}`));
+    },
+    decoded_audio_frames__deps: ['audio'],
+    decoded_audio_frames: function (id, channels, sampleRate) {
+        const buffer = _audio.decoded[id];
+        if (!buffer)
+            return 0;
+        HEAP32[channels >> 2] = Math.min(buffer.numberOfChannels, 2);
+        HEAP32[sampleRate >> 2] = buffer.sampleRate;
+        return buffer.length;
+    },
+    copy_decoded_audio__deps: ['audio'],
+    copy_decoded_audio: function (id, samples) {
+        const buffer = _audio.decoded[id];
+        const channels = Math.min(buffer.numberOfChannels, 2);
+        for (let c = 0; c < channels; ++c) {
+            const data = buffer.getChannelData(c);
+            for (let i = 0; i < data.length; ++i)
+                HEAP16[(samples >> 1) + i * channels + c] = Math.max(-32768, Math.min(32767, Math.round(data[i] * 32767)));
+        }
+        delete _audio.decoded[id];
     },
 });
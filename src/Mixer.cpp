@@ -0,0 +1,285 @@
+#include "Mixer.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#ifdef BATCHASE_SIMD
+bool mixerUseSimd = true;
+#else
+bool mixerUseSimd = false; // the target has no SIMD instructions
+#endif
+
+struct Sound
+{
+    std::vector<int16_t> samples;
+    int channels, frames, sampleRate;
+    // a looping voice waiting for the sound to load, gain <= 0 if none
+    float pendingGain, pendingPitch;
+};
+
+struct Voice
+{
+    int sound{-1}; // -1 if free
+    uint32_t generation;
+    uint64_t startOrder;
+    double position; // in frames of the sound
+    float step; // frames of the sound per output frame
+    bool loop;
+    bool stopping; // freed once the gain has ramped to 0
+    float gain, targetGain, gainStep;
+    int rampFrames; // left until gain reaches targetGain
+};
+
+int mixerSampleRate = 48000;
+Sound sounds[MIXER_MAX_SOUNDS];
+Voice voices[MIXER_MAX_VOICES];
+Voice fadingVoices[MIXER_MAX_FADING_VOICES];
+uint64_t nextStartOrder;
+std::mutex mixerMutex;
+
+void mixer_init(int sampleRate)
+{
+    std::lock_guard lock(mixerMutex);
+    mixerSampleRate = sampleRate;
+    std::fill(std::begin(voices), std::end(voices), Voice{});
+    std::fill(std::begin(fadingVoices), std::end(fadingVoices), Voice{});
+    for(Sound& s : sounds)
+        s.pendingGain = 0.f;
+}
+
+int16_t* mixer_load_sound(int sound, int channels, int frames, int sampleRate)
+{
+    std::lock_guard lock(mixerMutex);
+    Sound& s = sounds[sound];
+    s.channels = std::clamp(channels, 1, 2);
+    s.frames = frames;
+    s.sampleRate = sampleRate;
+    s.samples.assign(size_t(frames) * s.channels, 0);
+    return s.samples.data();
+}
+
+bool mixer_is_sound_loaded(int sound)
+{
+    std::lock_guard lock(mixerMutex);
+    return sounds[sound].frames > 0;
+}
+
+void ramp_gain(Voice& voice, float gain)
+{
+    voice.targetGain = gain;
+    voice.gainStep = (gain - voice.gain) / MIXER_RAMP_FRAMES;
+    voice.rampFrames = MIXER_RAMP_FRAMES;
+}
+
+void fade_out(const Voice& voice)
+{
+    // the voice that has been fading the longest makes room, it is the quietest
+    Voice* slot = std::min_element(std::begin(fadingVoices), std::end(fadingVoices),
+        [](const Voice& a, const Voice& b) { return (a.sound >= 0 ? a.rampFrames : -1) < (b.sound >= 0 ? b.rampFrames : -1); });
+    *slot = voice;
+    slot->stopping = true;
+    ramp_gain(*slot, 0.f);
+}
+
+VoiceHandle play_voice(int sound, float gain, float pitch, bool loop)
+{
+    Sound& s = sounds[sound];
+    if (s.frames <= 0)
+    {
+        if (loop)
+        {
+            s.pendingGain = gain;
+            s.pendingPitch = pitch;
+        }
+        return {};
+    }
+
+    // a free voice, or the oldest one, preferring one-shots over loops
+    Voice* voice = nullptr;
+    for(Voice& v : voices)
+    {
+        auto key = [](const Voice& x) { return std::make_pair(x.sound >= 0 && x.loop, x.sound >= 0 ? x.startOrder + 1 : 0); };
+        if (!voice || key(v) < key(*voice))
+            voice = &v;
+    }
+    if (voice->sound >= 0)
+        fade_out(*voice);
+
+    const uint32_t generation = voice->generation + 1;
+    *voice = { .sound = sound, .generation = generation, .startOrder = nextStartOrder++, .position = 0.0,
+        .step = pitch * s.sampleRate / mixerSampleRate, .loop = loop, .gain = 0.f };
+    ramp_gain(*voice, gain);
+    return { uint32_t(voice - voices), generation };
+}
+
+VoiceHandle mixer_play(int sound, float gain, float pitch, bool loop)
+{
+    std::lock_guard lock(mixerMutex);
+    return play_voice(sound, gain, pitch, loop);
+}
+
+Voice* get_voice(VoiceHandle handle)
+{
+    if (handle.slot >= MIXER_MAX_VOICES || voices[handle.slot].generation != handle.generation || voices[handle.slot].sound < 0)
+        return nullptr;
+    return &voices[handle.slot];
+}
+
+void mixer_set_gain(VoiceHandle handle, float gain)
+{
+    std::lock_guard lock(mixerMutex);
+    if (Voice* voice = get_voice(handle))
+        ramp_gain(*voice, gain);
+}
+
+void mixer_stop(VoiceHandle handle)
+{
+    std::lock_guard lock(mixerMutex);
+    if (Voice* voice = get_voice(handle))
+    {
+        fade_out(*voice);
+        voice->sound = -1;
+    }
+}
+
+int mixer_num_playing_voices()
+{
+    std::lock_guard lock(mixerMutex);
+    return std::count_if(std::begin(voices), std::end(voices), [](const Voice& v) { return v.sound >= 0; });
+}
+
+// Adds count frames from position on with the gain going up by gainStep a frame, the sound plays at its own rate
+void mix_frames(const Sound& s, int position, float* left, float* right, int count, float gain, float gainStep)
+{
+    constexpr float scale = 1.f / 32768.f;
+    int i = 0;
+#ifdef BATCHASE_SIMD
+    if (mixerUseSimd)
+    {
+        const f32x4 scale4 = f32x4_splat(scale), gain4 = f32x4_splat(gain), gainStep4 = f32x4_splat(gainStep);
+        for(; i + 4 <= count; i += 4)
+        {
+            const f32x4 g = f32x4_add(gain4, f32x4_mul(gainStep4, f32x4_make(float(i + 1), float(i + 2), float(i + 3), float(i + 4))));
+            f32x4 l, r;
+            if (s.channels == 1)
+                l = r = f32x4_mul(f32x4_load_i16(&s.samples[position + i]), scale4);
+            else
+            {
+                f32x4_deinterleave(f32x4_load_i16(&s.samples[2 * (position + i)]), f32x4_load_i16(&s.samples[2 * (position + i) + 4]), l, r);
+                l = f32x4_mul(l, scale4);
+                r = f32x4_mul(r, scale4);
+            }
+            f32x4_store(left + i, f32x4_add(f32x4_load(left + i), f32x4_mul(l, g)));
+            f32x4_store(right + i, f32x4_add(f32x4_load(right + i), f32x4_mul(r, g)));
+        }
+    }
+#endif
+    for(; i < count; ++i)
+    {
+        const float g = gain + gainStep * float(i + 1);
+        const int index = (position + i) * s.channels;
+        const float l = s.samples[index] * scale;
+        const float r = s.samples[index + s.channels - 1] * scale;
+        left[i] += l * g;
+        right[i] += r * g;
+    }
+}
+
+// Same with the sound resampled by linear interpolation
+void mix_frames_resampled(const Sound& s, double position, float step, float* left, float* right, int count, float gain, float gainStep)
+{
+    constexpr float scale = 1.f / 32768.f;
+    for(int i = 0; i < count; ++i)
+    {
+        const double p = position + double(step) * i;
+        const int index = (int)p;
+        const int next = std::min(index + 1, s.frames - 1);
+        const float t = float(p - index);
+        const float g = gain + gainStep * float(i + 1);
+        const int16_t* a = &s.samples[index * s.channels];
+        const int16_t* b = &s.samples[next * s.channels];
+        left[i] += (a[0] + (b[0] - a[0]) * t) * scale * g;
+        right[i] += (a[s.channels - 1] + (b[s.channels - 1] - a[s.channels - 1]) * t) * scale * g;
+    }
+}
+
+void mix_voice(Voice& voice, float* left, float* right, int frames)
+{
+    for(int done = 0; done < frames && voice.sound >= 0;)
+    {
+        const Sound& s = sounds[voice.sound];
+        const bool resampled = voice.step != 1.f || voice.position != std::floor(voice.position);
+        // up to the end of the sound, or to the end of the gain ramp
+        int count = std::min<double>(frames - done, std::ceil((s.frames - voice.position) / voice.step));
+        if (voice.rampFrames > 0)
+            count = std::min(count, voice.rampFrames);
+        const float gainStep = voice.rampFrames > 0 ? voice.gainStep : 0.f;
+
+        if (resampled)
+            mix_frames_resampled(s, voice.position, voice.step, left + done, right + done, count, voice.gain, gainStep);
+        else
+            mix_frames(s, (int)voice.position, left + done, right + done, count, voice.gain, gainStep);
+        done += count;
+        voice.position += double(voice.step) * count;
+
+        if (voice.rampFrames > 0)
+        {
+            voice.gain += gainStep * count;
+            voice.rampFrames -= count;
+            if (voice.rampFrames == 0)
+            {
+                voice.gain = voice.targetGain;
+                if (voice.stopping)
+                    voice.sound = -1;
+            }
+        }
+        if (voice.position >= s.frames)
+        {
+            if (voice.loop)
+                voice.position -= s.frames;
+            else
+                voice.sound = -1;
+        }
+    }
+}
+
+void mixer_render(float* left, float* right, int frames)
+{
+    std::lock_guard lock(mixerMutex);
+    for(int i = 0; i < MIXER_MAX_SOUNDS; ++i)
+    {
+        if (sounds[i].pendingGain > 0.f && sounds[i].frames > 0)
+        {
+            play_voice(i, sounds[i].pendingGain, sounds[i].pendingPitch, true);
+            sounds[i].pendingGain = 0.f;
+        }
+    }
+
+    std::fill(left, left + frames, 0.f);
+    std::fill(right, right + frames, 0.f);
+    for(Voice& voice : voices)
+        mix_voice(voice, left, right, frames);
+    for(Voice& voice : fadingVoices)
+        mix_voice(voice, left, right, frames);
+
+    int i = 0;
+#ifdef BATCHASE_SIMD
+    if (mixerUseSimd)
+    {
+        const f32x4 minus1 = f32x4_splat(-1.f), plus1 = f32x4_splat(1.f);
+        for(; i + 4 <= frames; i += 4)
+        {
+            f32x4_store(left + i, f32x4_clamp(f32x4_load(left + i), minus1, plus1));
+            f32x4_store(right + i, f32x4_clamp(f32x4_load(right + i), minus1, plus1));
+        }
+    }
+#endif
+    for(; i < frames; ++i)
+    {
+        left[i] = std::clamp(left[i], -1.f, 1.f);
+        right[i] = std::clamp(right[i], -1.f, 1.f);
+    }
+}
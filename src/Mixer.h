@@ -0,0 +1,36 @@
+// Software mixer for the sounds and the music: a fixed pool of voices mixed into a stereo float stream that the
+// platform plays, from an AudioWorklet on the web. The functions lock the mixer, the simulation can start sounds
+// from its own thread while the main thread mixes.
+#pragma once
+
+#include <cstdint>
+
+constexpr int MIXER_MAX_SOUNDS = 16;
+constexpr int MIXER_MAX_VOICES = 16;
+// voices that have been stolen or stopped fade out in these
+constexpr int MIXER_MAX_FADING_VOICES = 8;
+// length of the gain ramps, so that starting, stopping and stealing voices doesn't click
+constexpr int MIXER_RAMP_FRAMES = 64;
+
+struct VoiceHandle
+{
+    uint32_t slot{~0u};
+    uint32_t generation;
+};
+
+// Sets the output rate and stops all voices
+void mixer_init(int sampleRate);
+// Returns room for frames * channels interleaved samples of the sound. Fill it before the next mixer_render().
+int16_t* mixer_load_sound(int sound, int channels, int frames, int sampleRate);
+bool mixer_is_sound_loaded(int sound);
+// Starts a voice, stealing the oldest one if all of them are playing. Looping sounds that haven't loaded yet
+// start when they do, other sounds are skipped. pitch: playback speed, 1 is the original.
+VoiceHandle mixer_play(int sound, float gain, float pitch = 1.f, bool loop = false);
+void mixer_set_gain(VoiceHandle voice, float gain);
+void mixer_stop(VoiceHandle voice);
+int mixer_num_playing_voices();
+// Mixes the next frames, overwriting left and right
+void mixer_render(float* left, float* right, int frames);
+
+// the SIMD kernels, on when the target has them
+extern bool mixerUseSimd;
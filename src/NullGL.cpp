@@ -0,0 +1,81 @@
+// GLES 3 entry points used by the renderer, implemented as no-ops for the headless native build, or drawn by the
+// software rasterizer (SoftGL.h) once it has been initialized.
+// Object names are handed out from a counter so that the renderer sees valid, distinct names.
+// Every call is counted, see NullGL.h.
+#include "NullGL.h"
+#include "SoftGL.h"
+
+#include <GLES3/gl3.h>
+
+GLCallCounter glCallCounters[MaxGLCallCounters];
+int numGLCallCounters;
+
+static int register_gl_call(const char* name)
+{
+    glCallCounters[numGLCallCounters] = { name, 0 };
+    return numGLCallCounters++;
+}
+
+// counts the calls of the enclosing GL function, the counter is registered on the first call
+#define RECORD_CALL() static const int counter = register_gl_call(__func__); ++glCallCounters[counter].count
+
+uint64_t total_gl_calls()
+{
+    uint64_t total = 0;
+    for(int i = 0; i < numGLCallCounters; ++i)
+        total += glCallCounters[i].count;
+    return total;
+}
+
+static GLuint nextName = 1;
+
+static void gen_names(GLsizei n, GLuint* names)
+{
+    for(GLsizei i = 0; i < n; ++i)
+        names[i] = nextName++;
+}
+
+extern "C"
+{
+GLuint glCreateShader(GLenum) { RECORD_CALL(); return nextName++; }
+void glShaderSource(GLuint, GLsizei, const GLchar* const*, const GLint*) { RECORD_CALL(); }
+void glCompileShader(GLuint) { RECORD_CALL(); }
+GLuint glCreateProgram() { RECORD_CALL(); return nextName++; }
+void glAttachShader(GLuint, GLuint) { RECORD_CALL(); }
+void glBindAttribLocation(GLuint, GLuint, const GLchar*) { RECORD_CALL(); }
+void glLinkProgram(GLuint) { RECORD_CALL(); }
+void glUseProgram(GLuint) { RECORD_CALL(); }
+GLint glGetUniformLocation(GLuint, const GLchar*) { RECORD_CALL(); return 0; }
+void glUniform1i(GLint, GLint) { RECORD_CALL(); }
+void glUniform2f(GLint location, GLfloat x, GLfloat y) { RECORD_CALL(); if (softGLEnabled) soft_gl_uniform2f(location, x, y); }
+
+void glEnable(GLenum cap) { RECORD_CALL(); if (softGLEnabled) soft_gl_set_capability(cap, true); }
+void glDisable(GLenum cap) { RECORD_CALL(); if (softGLEnabled) soft_gl_set_capability(cap, false); }
+void glBlendFunc(GLenum, GLenum) { RECORD_CALL(); }
+void glBlendFuncSeparate(GLenum, GLenum, GLenum, GLenum) { RECORD_CALL(); }
+void glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { RECORD_CALL(); if (softGLEnabled) soft_gl_viewport(x, y, width, height); }
+void glClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) { RECORD_CALL(); if (softGLEnabled) soft_gl_clear_color(r, g, b, a); }
+void glClear(GLbitfield mask) { RECORD_CALL(); if (softGLEnabled) soft_gl_clear(mask); }
+
+void glGenBuffers(GLsizei n, GLuint* buffers) { RECORD_CALL(); gen_names(n, buffers); }
+void glBindBuffer(GLenum target, GLuint buffer) { RECORD_CALL(); if (softGLEnabled) soft_gl_bind_buffer(target, buffer); }
+void glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum) { RECORD_CALL(); if (softGLEnabled) soft_gl_buffer_data(target, size, data); }
+void glVertexAttribPointer(GLuint index, GLint, GLenum, GLboolean, GLsizei stride, const void* offset) { RECORD_CALL(); if (softGLEnabled) soft_gl_vertex_attrib_pointer(index, stride, offset); }
+void glVertexAttribDivisor(GLuint, GLuint) { RECORD_CALL(); }
+void glEnableVertexAttribArray(GLuint) { RECORD_CALL(); }
+void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances) { RECORD_CALL(); if (softGLEnabled) soft_gl_draw_arrays_instanced(mode, first, count, instances); }
+
+void glGenTextures(GLsizei n, GLuint* textures) { RECORD_CALL(); gen_names(n, textures); }
+void glDeleteTextures(GLsizei n, const GLuint* textures) { RECORD_CALL(); if (softGLEnabled) soft_gl_delete_textures(n, textures); }
+void glActiveTexture(GLenum unit) { RECORD_CALL(); if (softGLEnabled) soft_gl_active_texture(unit); }
+void glBindTexture(GLenum target, GLuint texture) { RECORD_CALL(); if (softGLEnabled) soft_gl_bind_texture(target, texture); }
+void glTexParameteri(GLenum, GLenum, GLint) { RECORD_CALL(); }
+void glPixelStorei(GLenum, GLint) { RECORD_CALL(); }
+void glTexStorage2D(GLenum, GLsizei, GLenum internalFormat, GLsizei width, GLsizei height) { RECORD_CALL(); if (softGLEnabled) soft_gl_tex_storage_2d(internalFormat, width, height); }
+// the pixels are in the format of the texture, RGBA or R8 bytes
+void glTexSubImage2D(GLenum, GLint, GLint x, GLint y, GLsizei width, GLsizei height, GLenum, GLenum, const void* pixels) { RECORD_CALL(); if (softGLEnabled) soft_gl_tex_sub_image_2d(x, y, width, height, pixels); }
+
+void glGenFramebuffers(GLsizei n, GLuint* framebuffers) { RECORD_CALL(); gen_names(n, framebuffers); }
+void glBindFramebuffer(GLenum target, GLuint framebuffer) { RECORD_CALL(); if (softGLEnabled) soft_gl_bind_framebuffer(target, framebuffer); }
+void glFramebufferTexture2D(GLenum target, GLenum, GLenum, GLuint texture, GLint) { RECORD_CALL(); if (softGLEnabled) soft_gl_framebuffer_texture_2d(target, texture); }
+}
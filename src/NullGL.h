@@ -0,0 +1,17 @@
+// Call counts of the null GL (NullGL.cpp), for the benchmarks
+#pragma once
+
+#include <cstdint>
+
+struct GLCallCounter
+{
+    const char* name;
+    uint64_t count;
+};
+
+constexpr int MaxGLCallCounters = 64;
+// one per GL function that has been called at least once
+extern GLCallCounter glCallCounters[MaxGLCallCounters];
+extern int numGLCallCounters;
+
+uint64_t total_gl_calls();
@@ -0,0 +1,325 @@
+// Packs the assets in build/ into a single bundle that the game streams in with one request:
+//   build/BatChasePacker --assets build --out build/BatChase.bundle
+// The PNGs are packed into one atlas with a palette of their colours, 16-bit wavs are compressed to IMA ADPCM and the rest is stored as it is.
+// Entries are written in the order the game needs them: the atlas, then the sounds. The font is baked into the
+// game instead (FontBaker.cpp).
+#include "Bundle.h"
+
+#include <png.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+constexpr int ATLAS_PADDING = 1;
+
+struct Asset
+{
+    BundleEntry entry;
+    std::vector<uint8_t> data;
+};
+
+struct Sprite
+{
+    std::string name;
+    int width, height;
+    std::vector<uint8_t> indices; // into the atlas palette, top row first
+    int x, y;
+};
+
+// The colours of all the sprites as RGBA bytes, 0 is transparent and fills the gaps of the atlas
+struct AtlasPalette
+{
+    uint32_t colors[256]{};
+    int numColors = 1;
+};
+
+std::vector<uint8_t> read_file(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), {});
+}
+
+bool set_name(BundleEntry& entry, const std::string& name)
+{
+    if (name.size() >= sizeof(entry.name))
+    {
+        std::fprintf(stderr, "%s: name is too long for the bundle\n", name.c_str());
+        return false;
+    }
+    std::strcpy(entry.name, name.c_str());
+    return true;
+}
+
+bool load_sprite(const std::filesystem::path& path, Sprite& sprite, AtlasPalette& palette)
+{
+    png_image image{};
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str()))
+    {
+        std::fprintf(stderr, "Cannot load %s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    image.format = PNG_FORMAT_RGBA_COLORMAP;
+    sprite.width = image.width;
+    sprite.height = image.height;
+    sprite.indices.resize(PNG_IMAGE_SIZE(image));
+    uint8_t colormap[256 * 4];
+    if (!png_image_finish_read(&image, nullptr, sprite.indices.data(), 0, colormap))
+    {
+        std::fprintf(stderr, "Cannot decode %s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    // the sprite's colours in the atlas palette
+    uint8_t indices[256];
+    for(uint32_t i = 0; i < image.colormap_entries; ++i)
+    {
+        uint32_t color = 0;
+        if (colormap[4 * i + 3] != 0)
+            std::memcpy(&color, &colormap[4 * i], 4);
+        const int found = int(std::find(palette.colors, palette.colors + palette.numColors, color) - palette.colors);
+        if (found == 256)
+        {
+            std::fprintf(stderr, "%s: the sprites have more than 256 colours\n", path.c_str());
+            return false;
+        }
+        if (found == palette.numColors)
+            palette.colors[palette.numColors++] = color;
+        indices[i] = (uint8_t)found;
+    }
+    for(uint8_t& index : sprite.indices)
+        index = indices[index];
+    sprite.name = path.filename().string();
+    return true;
+}
+
+// Shelf packs the sprites, tallest first, and returns the atlas entry followed by one entry per sprite
+bool pack_atlas(std::vector<Sprite>& sprites, const AtlasPalette& palette, std::vector<Asset>& assets)
+{
+    std::sort(sprites.begin(), sprites.end(), [](const Sprite& a, const Sprite& b) { return a.height > b.height; });
+    int shelfY = 0, shelfHeight = 0, nextX = 0, atlasWidth = 0;
+    for(Sprite& sprite : sprites)
+    {
+        if (sprite.width > BUNDLE_ATLAS_MAX_WIDTH)
+        {
+            std::fprintf(stderr, "%s is wider than the atlas\n", sprite.name.c_str());
+            return false;
+        }
+        if (nextX + sprite.width > BUNDLE_ATLAS_MAX_WIDTH)
+        {
+            shelfY += shelfHeight;
+            shelfHeight = nextX = 0;
+        }
+        sprite.x = nextX;
+        sprite.y = shelfY;
+        nextX += sprite.width + ATLAS_PADDING;
+        shelfHeight = std::max(shelfHeight, sprite.height + ATLAS_PADDING);
+        atlasWidth = std::max(atlasWidth, sprite.x + sprite.width);
+    }
+    const int atlasHeight = shelfY + shelfHeight;
+
+    std::vector<uint8_t> indices(size_t(atlasWidth) * atlasHeight);
+    for(const Sprite& sprite : sprites)
+        for(int row = 0; row < sprite.height; ++row)
+            std::memcpy(&indices[size_t(sprite.y + row) * atlasWidth + sprite.x], &sprite.indices[size_t(row) * sprite.width], sprite.width);
+
+    // top row first, the game uploads the rows in this order and flips the sprites with their UVs
+    png_image image{};
+    image.version = PNG_IMAGE_VERSION;
+    image.width = atlasWidth;
+    image.height = atlasHeight;
+    image.format = PNG_FORMAT_RGBA_COLORMAP;
+    image.colormap_entries = palette.numColors;
+    png_alloc_size_t size = 0;
+    png_image_write_to_memory(&image, nullptr, &size, 0, indices.data(), 0, palette.colors);
+    Asset atlas{ .entry = { .name = "atlas", .type = BUNDLE_ATLAS } };
+    atlas.data.resize(size);
+    if (!png_image_write_to_memory(&image, atlas.data.data(), &size, 0, indices.data(), 0, palette.colors))
+    {
+        std::fprintf(stderr, "Cannot encode the atlas: %s\n", image.message);
+        return false;
+    }
+    atlas.data.resize(size);
+    atlas.entry.sprite = { 0, 0, (uint32_t)atlasWidth, (uint32_t)atlasHeight };
+    assets.push_back(std::move(atlas));
+
+    for(const Sprite& sprite : sprites)
+    {
+        Asset& asset = assets.emplace_back(Asset{ .entry = { .type = BUNDLE_SPRITE } });
+        if (!set_name(asset.entry, sprite.name))
+            return false;
+        asset.entry.sprite = { (uint32_t)sprite.x, (uint32_t)sprite.y, (uint32_t)sprite.width, (uint32_t)sprite.height };
+    }
+    std::printf("atlas: %d sprites in %dx%d, %d colours, %zu bytes\n", (int)sprites.size(), atlasWidth, atlasHeight, palette.numColors, size);
+    return true;
+}
+
+const int imaIndexTable[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+const int imaStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+    107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871,
+    5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623,
+    27086, 29794, 32767
+};
+
+// One channel of interleaved 16-bit samples to 4-bit codes, two per byte with the first in the low bits.
+// The decoder in LibBatChase.js starts from the same state: predictor 0, step index 0.
+void encode_ima_adpcm(const int16_t* samples, int channels, int frames, std::vector<uint8_t>& out)
+{
+    int predictor = 0, index = 0;
+    for(int i = 0; i < frames; ++i)
+    {
+        const int step = imaStepTable[index];
+        int diff = samples[i * channels] - predictor;
+        int code = 0;
+        if (diff < 0)
+        {
+            code = 8;
+            diff = -diff;
+        }
+        if (diff >= step) { code |= 4; diff -= step; }
+        if (diff >= step / 2) { code |= 2; diff -= step / 2; }
+        if (diff >= step / 4) { code |= 1; }
+
+        // update the predictor exactly like the decoder does
+        int delta = step >> 3;
+        if (code & 4) delta += step;
+        if (code & 2) delta += step >> 1;
+        if (code & 1) delta += step >> 2;
+        predictor = std::clamp(code & 8 ? predictor - delta : predictor + delta, -32768, 32767);
+        index = std::clamp(index + imaIndexTable[code], 0, 88);
+
+        if (i % 2 == 0)
+            out.push_back(code);
+        else
+            out.back() |= code << 4;
+    }
+}
+
+uint32_t read_u32(const uint8_t* p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+uint16_t read_u16(const uint8_t* p) { return p[0] | p[1] << 8; }
+
+// Returns false if the file isn't a 16-bit PCM wav, it is then stored as it is
+bool compress_wav(const std::vector<uint8_t>& wav, Asset& asset)
+{
+    if (wav.size() < 12 || std::memcmp(wav.data(), "RIFF", 4) || std::memcmp(wav.data() + 8, "WAVE", 4))
+        return false;
+    const uint8_t* format = nullptr;
+    const uint8_t* data = nullptr;
+    uint32_t dataSize = 0;
+    for(size_t pos = 12; pos + 8 <= wav.size();)
+    {
+        const uint32_t chunkSize = read_u32(&wav[pos + 4]);
+        if (pos + 8 + chunkSize > wav.size())
+            break;
+        if (!std::memcmp(&wav[pos], "fmt ", 4) && chunkSize >= 16)
+            format = &wav[pos + 8];
+        else if (!std::memcmp(&wav[pos], "data", 4))
+        {
+            data = &wav[pos + 8];
+            dataSize = chunkSize;
+        }
+        pos += 8 + chunkSize + (chunkSize & 1);
+    }
+    if (!format || !data || read_u16(format) != 1 || read_u16(format + 14) != 16)
+        return false;
+
+    const int channels = read_u16(format + 2);
+    const int frames = dataSize / (2 * channels);
+    std::vector<int16_t> samples(frames * channels);
+    std::memcpy(samples.data(), data, samples.size() * sizeof(int16_t));
+    for(int c = 0; c < channels; ++c)
+    {
+        encode_ima_adpcm(samples.data() + c, channels, frames, asset.data);
+        asset.data.resize((c + 1) * size_t((frames + 1) / 2));
+    }
+    asset.entry.type = BUNDLE_IMA_ADPCM;
+    asset.entry.adpcm = { read_u32(format + 4), (uint32_t)channels, (uint32_t)frames, 0 };
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path assetDirectory = "build", outPath = "build/BatChase.bundle";
+    for(int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--assets") && i + 1 < argc)
+            assetDirectory = argv[++i];
+        else if (!std::strcmp(argv[i], "--out") && i + 1 < argc)
+            outPath = argv[++i];
+        else
+        {
+            std::printf("usage: %s [--assets DIR] [--out FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<std::filesystem::path> paths;
+    for(const auto& file : std::filesystem::directory_iterator(assetDirectory))
+        paths.push_back(file.path());
+    std::sort(paths.begin(), paths.end());
+
+    std::vector<Asset> assets, sounds;
+    std::vector<Sprite> sprites;
+    AtlasPalette palette;
+    size_t inputBytes = 0;
+    for(const auto& path : paths)
+    {
+        const std::string extension = path.extension().string();
+        if (extension == ".png")
+        {
+            if (!load_sprite(path, sprites.emplace_back(), palette))
+                return 1;
+        }
+        else if (extension == ".mp3" || extension == ".wav")
+        {
+            Asset asset{ .entry = { .type = BUNDLE_FILE } };
+            if (!set_name(asset.entry, path.filename().string()))
+                return 1;
+            std::vector<uint8_t> data = read_file(path);
+            if (extension != ".wav" || !compress_wav(data, asset))
+                asset.data = std::move(data);
+            sounds.push_back(std::move(asset));
+        }
+        else
+            continue;
+        inputBytes += std::filesystem::file_size(path);
+    }
+
+    if (!sprites.empty() && !pack_atlas(sprites, palette, assets))
+        return 1;
+    for(Asset& sound : sounds)
+        assets.push_back(std::move(sound));
+    if (assets.size() > MaxBundleEntries)
+    {
+        std::fprintf(stderr, "%zu assets, the bundle has room for %d\n", assets.size(), MaxBundleEntries);
+        return 1;
+    }
+
+    const BundleHeader header{ .magic = BUNDLE_MAGIC, .numEntries = (uint32_t)assets.size() };
+    uint32_t offset = sizeof(header) + assets.size() * sizeof(BundleEntry);
+    for(Asset& asset : assets)
+    {
+        asset.entry.offset = offset;
+        asset.entry.size = asset.data.size();
+        offset += asset.data.size();
+    }
+
+    std::ofstream out(outPath, std::ios::binary);
+    out.write((const char*)&header, sizeof(header));
+    for(const Asset& asset : assets)
+        out.write((const char*)&asset.entry, sizeof(asset.entry));
+    for(const Asset& asset : assets)
+        out.write((const char*)asset.data.data(), asset.data.size());
+    if (!out)
+    {
+        std::fprintf(stderr, "Cannot write %s\n", outPath.c_str());
+        return 1;
+    }
+    std::printf("%s: %zu entries, %u bytes (%zu bytes of assets)\n", outPath.c_str(), assets.size(), offset, inputBytes);
+}
@@ -0,0 +1,161 @@
+#include "Particles.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+ParticlePool particles;
+
+#ifdef BATCHASE_SIMD
+bool particlesUseSimd = true;
+#else
+bool particlesUseSimd = false; // the target has no SIMD instructions
+#endif
+
+// the part of its velocity a particle keeps after a ms, sparks slide 50-100 px before they stop
+constexpr float PARTICLE_DRAG_PER_MS = 0.99f;
+// closing speed (px/ms) below which the cars only nudge each other, e.g. in a jam
+constexpr float MIN_IMPACT_SPEED = 0.05f;
+constexpr int MAX_SPARKS_PER_HIT = 24;
+constexpr uint32_t PARTICLE_SEED = 0x9E3779B9u;
+
+// xorshift32, [0, 1)
+float random_unit(uint32_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return (state >> 8) * (1.f / 16777216.f);
+}
+
+void add_particle(ParticleKind kind, float x, float y, float velx, float vely, float lifeMs)
+{
+    ParticlePool& p = particles;
+    if (p.count == MAX_PARTICLES)
+        return;
+    const size_t i = p.count++;
+    p.x[i] = x;
+    p.y[i] = y;
+    p.velx[i] = velx;
+    p.vely[i] = vely;
+    p.life[i] = 1.f;
+    p.fade[i] = 1.f / lifeMs;
+    p.kind[i] = kind;
+}
+
+void emit_collision_particles(float x, float y, float normalX, float normalY, float speed)
+{
+    if (speed < MIN_IMPACT_SPEED)
+        return;
+    uint32_t& random = particles.random;
+    // the sparks fly along the contact to both sides and a little along the normal, the faster the harder the hit
+    const int sparks = std::min(MAX_SPARKS_PER_HIT, int(speed * 60.f));
+    const float tangentX = -normalY, tangentY = normalX, sparkSpeed = 0.3f + speed;
+    for(int i = 0; i < sparks; ++i)
+    {
+        const float along = (random_unit(random) * 2.f - 1.f) * sparkSpeed;
+        const float across = (random_unit(random) * 2.f - 1.f) * 0.3f * sparkSpeed;
+        add_particle(PARTICLE_SPARK, x, y, tangentX * along + normalX * across, tangentY * along + normalY * across,
+            150.f + 250.f * random_unit(random));
+    }
+    // the smoke drifts slowly where the tyres scrubbed
+    for(int i = 0; i < 1 + sparks / 6; ++i)
+    {
+        const float dx = (random_unit(random) - 0.5f) * 8.f, dy = (random_unit(random) - 0.5f) * 8.f;
+        add_particle(PARTICLE_SMOKE, x + dx, y + dy, dx * 0.005f, dy * 0.005f, 500.f + 400.f * random_unit(random));
+    }
+}
+
+// Returns true if a particle faded out. The blocks are whole: the lanes past count are moved too, they never fade.
+bool update_particles_scalar(ParticlePool& p, size_t blocks, float dt, float shift, float drag)
+{
+    bool faded = false;
+    for(size_t i = 0; i < blocks * 4; ++i)
+    {
+        p.x[i] = p.x[i] + p.velx[i] * dt + shift;
+        p.y[i] = p.y[i] + p.vely[i] * dt;
+        p.velx[i] *= drag;
+        p.vely[i] *= drag;
+        p.life[i] -= p.fade[i] * dt;
+        faded |= p.life[i] <= 0.f;
+    }
+    return faded;
+}
+
+#ifdef BATCHASE_SIMD
+bool update_particles_simd(ParticlePool& p, size_t blocks, float dt, float shift, float drag)
+{
+    const f32x4 dt4 = f32x4_splat(dt), shift4 = f32x4_splat(shift), drag4 = f32x4_splat(drag), zero = f32x4_splat(0.f);
+    const f32x4 negDt4 = f32x4_neg(dt4);
+    int faded = 0;
+    for(size_t i = 0; i < blocks * 4; i += 4)
+    {
+        const f32x4 velx = f32x4_load(p.velx + i), vely = f32x4_load(p.vely + i);
+        f32x4_store(p.x + i, f32x4_add(f32x4_add(f32x4_load(p.x + i), f32x4_mul(velx, dt4)), shift4));
+        f32x4_store(p.y + i, f32x4_add(f32x4_load(p.y + i), f32x4_mul(vely, dt4)));
+        f32x4_store(p.velx + i, f32x4_mul(velx, drag4));
+        f32x4_store(p.vely + i, f32x4_mul(vely, drag4));
+        const f32x4 life = f32x4_add(f32x4_load(p.life + i), f32x4_mul(f32x4_load(p.fade + i), negDt4));
+        f32x4_store(p.life + i, life);
+        faded |= m32x4_bits(f32x4_le(life, zero));
+    }
+    return faded;
+}
+#endif
+
+void update_particles(float dt, float scroll)
+{
+    ParticlePool& p = particles;
+    p.scroll = scroll;
+    const size_t blocks = (p.count + 3) / 4;
+    const float shift = -scroll * dt, drag = std::pow(PARTICLE_DRAG_PER_MS, dt);
+#ifdef BATCHASE_SIMD
+    const bool faded = particlesUseSimd ? update_particles_simd(p, blocks, dt, shift, drag) : update_particles_scalar(p, blocks, dt, shift, drag);
+#else
+    const bool faded = update_particles_scalar(p, blocks, dt, shift, drag);
+#endif
+    if (!faded)
+        return;
+    // the last particle takes the place of the one that faded
+    for(size_t i = 0; i < p.count;)
+    {
+        if (p.life[i] > 0.f)
+        {
+            ++i;
+            continue;
+        }
+        const size_t last = --p.count;
+        p.x[i] = p.x[last];
+        p.y[i] = p.y[last];
+        p.velx[i] = p.velx[last];
+        p.vely[i] = p.vely[last];
+        p.life[i] = p.life[last];
+        p.fade[i] = p.fade[last];
+        p.kind[i] = p.kind[last];
+        p.life[last] = 1.f;
+        p.fade[last] = 0.f;
+    }
+}
+
+void clear_particles()
+{
+    // the free slots never fade, so that the kernel can run over whole blocks
+    std::fill(std::begin(particles.life), std::end(particles.life), 1.f);
+    std::fill(std::begin(particles.fade), std::end(particles.fade), 0.f);
+    particles.count = 0;
+    particles.scroll = 0.f;
+    particles.random = PARTICLE_SEED;
+}
+
+void copy_particles(ParticlePool& to, const ParticlePool& from)
+{
+    const size_t n = from.count;
+    for(auto array : { &ParticlePool::x, &ParticlePool::y, &ParticlePool::velx, &ParticlePool::vely, &ParticlePool::life, &ParticlePool::fade })
+        std::memcpy(to.*array, from.*array, n * sizeof(float));
+    std::memcpy(to.kind, from.kind, n);
+    to.count = n;
+    to.scroll = from.scroll;
+    to.random = from.random;
+}
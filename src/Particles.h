@@ -0,0 +1,46 @@
+// Sparks and tyre smoke thrown up where the cars hit each other. They are only drawn, never collided, so rather
+// than being entities they live in a fixed pool of their own: separate arrays that a tick moves four at a time
+// with the SIMD kernel, and that the renderer draws with a single instanced draw.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// a multiple of 4, the kernel works on whole blocks
+constexpr size_t MAX_PARTICLES = 32768;
+
+enum ParticleKind : uint8_t
+{
+    PARTICLE_SPARK,
+    PARTICLE_SMOKE
+};
+
+struct ParticlePool
+{
+    // the live particles are the first count of each array, in no particular order. The free ones have a life of 1
+    // that doesn't fade.
+    alignas(16) float x[MAX_PARTICLES];
+    alignas(16) float y[MAX_PARTICLES];
+    alignas(16) float velx[MAX_PARTICLES];
+    alignas(16) float vely[MAX_PARTICLES];
+    alignas(16) float life[MAX_PARTICLES]; // 1 when emitted, gone at 0
+    alignas(16) float fade[MAX_PARTICLES]; // life lost per ms
+    ParticleKind kind[MAX_PARTICLES];
+    size_t count;
+    float scroll; // the camera speed (px/ms) of the latest tick, for drawing between ticks
+    uint32_t random; // the emitters' own generator, so that the sparks don't change how a game plays out
+};
+
+extern ParticlePool particles;
+// the SIMD kernel, on when the target has it
+extern bool particlesUseSimd;
+
+// Throws sparks and smoke from a contact point. normalX, normalY: the direction the cars hit each other along,
+// speed: how fast they closed in (px/ms). Soft bumps throw nothing, and nothing more fits once the pool is full.
+void emit_collision_particles(float x, float y, float normalX, float normalY, float speed);
+// Moves the particles by a tick of dt ms and removes the ones that have faded out. scroll: the camera speed
+// (px/ms), the particles stay where they were on the road.
+void update_particles(float dt, float scroll);
+void clear_particles();
+// Copies the live particles, for handing them to another thread
+void copy_particles(ParticlePool& to, const ParticlePool& from);
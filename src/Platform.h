@@ -0,0 +1,36 @@
+// Services the platform backends provide for the game
+#pragma once
+
+#include "Bundle.h"
+
+#ifdef __EMSCRIPTEN__
+#include <webgl/webgl2.h>
+#else
+#include <GLES3/gl3.h> // implemented by NullGL.cpp
+#endif
+
+// Implemented in LibBatChase.js on the web and in PlatformLinux.cpp natively
+extern "C"
+{
+// Starts streaming the asset bundle, index and progress are filled as it arrives. Sounds that are in the
+// bundle are then loaded from it instead of their own URLs, so call this first.
+void load_bundle(const char* url, BundleIndex* index, BundleProgress* progress);
+// Images are decoded from palette PNGs to one index byte per pixel, the top row first, and the colours of their
+// palette. An image is an image file requested with load_image(), or an atlas entry of the bundle by
+// bundle_image_id(), which is decoded by the time the entry is ready.
+void load_image(int imageId, const char* url);
+// Returns false until the image has been decoded
+bool decoded_image_size(int imageId, int* width, int* height, int* colors);
+// Writes width * height indices and colors RGBA colours, then frees the decoded image
+void copy_decoded_image(int imageId, uint8_t* indices, uint8_t* palette);
+// Decodes a sound for the mixer (Mixer.h), the platform loads it into the mixer once it is ready
+void preload_audio(int audioId, const char* url);
+}
+
+// the image id of an atlas entry of the bundle, the image files have ids from 0 up
+constexpr int bundle_image_id(int entry) { return -1 - entry; }
+
+#ifndef __EMSCRIPTEN__
+// directory the native backend loads the assets from
+extern const char* assetDirectory;
+#endif
@@ -0,0 +1,121 @@
+// Native Linux backend: no window and no audio, GL goes to NullGL.cpp. Images are decoded from the
+// asset directory so that the sprite sizes, and thus the collisions, match the web build.
+#include "Platform.h"
+
+#include <png.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+const char* assetDirectory = "build";
+
+static std::vector<uint8_t> bundle;
+
+struct DecodedImage
+{
+    int width, height, colors;
+    std::vector<uint8_t> indices;
+    uint8_t palette[256 * 4];
+};
+// by image id, until the game copies them, width 0 if the image couldn't be decoded
+static std::map<int, DecodedImage> decodedImages;
+
+// Finishes reading a PNG as indices into a colour map, which libpng builds for the images that have no palette
+static void decode_image(png_image& image, const char* name, DecodedImage& decoded)
+{
+    image.format = PNG_FORMAT_RGBA_COLORMAP;
+    decoded.indices.resize(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, nullptr, decoded.indices.data(), 0, decoded.palette))
+    {
+        std::fprintf(stderr, "Cannot decode %s: %s\n", name, image.message);
+        decoded.width = 0;
+        return;
+    }
+    decoded.width = image.width;
+    decoded.height = image.height;
+    decoded.colors = image.colormap_entries;
+}
+
+extern "C"
+{
+// Reads the whole bundle at once, everything in it is ready straight away
+void load_bundle(const char* url, BundleIndex* index, BundleProgress* progress)
+{
+    std::string path = std::string(assetDirectory) + "/" + url;
+    std::ifstream file(path, std::ios::binary);
+    bundle.assign(std::istreambuf_iterator<char>(file), {});
+    *progress = { .bytesLoaded = (uint32_t)bundle.size(), .bytesTotal = (uint32_t)bundle.size(), .state = BUNDLE_FAILED };
+
+    BundleHeader header;
+    if (bundle.size() < sizeof(header))
+    {
+        std::fprintf(stderr, "Cannot load %s\n", path.c_str());
+        return;
+    }
+    std::memcpy(&header, bundle.data(), sizeof(header));
+    const size_t indexSize = sizeof(header) + header.numEntries * sizeof(BundleEntry);
+    if (header.magic != BUNDLE_MAGIC || header.numEntries > MaxBundleEntries || bundle.size() < indexSize)
+    {
+        std::fprintf(stderr, "%s is not a bundle\n", path.c_str());
+        return;
+    }
+    std::memcpy(index, bundle.data(), indexSize);
+    for(uint32_t i = 0; i < header.numEntries; ++i)
+        progress->entryReady[i] = index->entries[i].offset + index->entries[i].size <= bundle.size();
+    progress->state = BUNDLE_DONE;
+}
+
+void load_image(int imageId, const char* url)
+{
+    std::string path = std::string(assetDirectory) + "/" + url;
+    png_image image{};
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str()))
+    {
+        std::fprintf(stderr, "Cannot load %s: %s\n", path.c_str(), image.message);
+        return;
+    }
+    decode_image(image, path.c_str(), decodedImages[imageId]);
+}
+
+bool decoded_image_size(int imageId, int* width, int* height, int* colors)
+{
+    auto it = decodedImages.find(imageId);
+    // the bundle's atlas is decoded when the game asks for it
+    if (it == decodedImages.end() && imageId < 0 && !bundle.empty())
+    {
+        const int entry = -1 - imageId;
+        BundleEntry e;
+        std::memcpy(&e, bundle.data() + sizeof(BundleHeader) + entry * sizeof(BundleEntry), sizeof(e));
+        png_image image{};
+        image.version = PNG_IMAGE_VERSION;
+        if (!png_image_begin_read_from_memory(&image, bundle.data() + e.offset, e.size))
+        {
+            std::fprintf(stderr, "Cannot load %s: %s\n", e.name, image.message);
+            return false;
+        }
+        it = decodedImages.emplace(imageId, DecodedImage{}).first;
+        decode_image(image, e.name, it->second);
+    }
+    if (it == decodedImages.end() || it->second.width == 0)
+        return false;
+    *width = it->second.width;
+    *height = it->second.height;
+    *colors = it->second.colors;
+    return true;
+}
+
+void copy_decoded_image(int imageId, uint8_t* indices, uint8_t* palette)
+{
+    auto it = decodedImages.find(imageId);
+    std::memcpy(indices, it->second.indices.data(), it->second.indices.size());
+    std::memcpy(palette, it->second.palette, it->second.colors * 4);
+    decodedImages.erase(it);
+}
+
+void preload_audio(int /* audioId */, const char* /* url */) {}
+}
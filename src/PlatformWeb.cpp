@@ -0,0 +1,183 @@
+// cspell:disable
+// Web backend: WebGL 2 canvas, DOM input events, requestAnimationFrame and Web Audio
+#include "Game.h"
+#include "Platform.h"
+#include "Mixer.h"
+
+#include <emscripten/html5.h>
+#include <emscripten/em_math.h>
+#include <emscripten/eventloop.h>
+#include <emscripten/dom_pk_codes.h>
+
+#include <algorithm>
+
+void ResizeCanvas(double windowInnerWidth, double windowInnerHeight)
+{
+    double scale = std::min(windowInnerWidth / GAME_WIDTH,  windowInnerHeight / GAME_HEIGHT);
+    emscripten_set_element_css_size("canvas", scale * GAME_WIDTH, scale * GAME_HEIGHT);
+    emscripten_set_canvas_element_size("canvas", GAME_WIDTH, GAME_HEIGHT);
+}
+
+void wake_up();
+
+EM_BOOL ResizeHandler(int /* eventType */, const EmscriptenUiEvent* uiEvent, void* /* userData */)
+{
+    ResizeCanvas(uiEvent->windowInnerWidth, uiEvent->windowInnerHeight);
+    // resizing clears the canvas
+    invalidate_frame();
+    wake_up();
+    return EM_FALSE;
+}
+
+void init_webgl()
+{
+    EM_ASM(document.body.style = 'margin: 0px; overflow: hidden; background: #787878;');
+    EM_ASM(document.querySelector('canvas').style['imageRendering'] = 'pixelated');
+
+    ResizeCanvas(EM_ASM_DOUBLE(return window.innerWidth), EM_ASM_DOUBLE(return window.innerHeight));
+
+    EmscriptenWebGLContextAttributes attrs;
+    emscripten_webgl_init_context_attributes(&attrs);
+    attrs.alpha = EM_FALSE;
+    attrs.majorVersion = 2;
+    emscripten_webgl_make_context_current(
+        emscripten_webgl_create_context("canvas", &attrs)
+    );
+}
+
+// Implemented in LibBatChase.js
+extern "C"
+{
+// Starts the AudioWorklet that plays what submit_audio() sends it, returns the sample rate
+int init_audio_output();
+// Returns the length of a sound the browser has decoded, 0 until then
+int decoded_audio_frames(int audioId, int* channels, int* sampleRate);
+// Writes the decoded sound as interleaved 16-bit samples and frees it
+void copy_decoded_audio(int audioId, int16_t* samples);
+// Frames to mix to stay leadMs ahead of playback
+int audio_frames_needed(double leadMs);
+void submit_audio(const float* left, const float* right, int frames);
+}
+
+// While the scene is static (is_scene_static()) the animation frames stop and a timer wakes the game this often
+// instead, to run its ticks and keep the audio fed. Input brings the animation frames back straight away.
+constexpr int IDLE_INTERVAL_MS = 50;
+// how far ahead of playback the audio is mixed: enough to cover a late animation frame, or an idle wakeup
+constexpr double AUDIO_LEAD_MS = 40.0, IDLE_AUDIO_LEAD_MS = 2.0 * IDLE_INTERVAL_MS;
+long idleTimeout; // of the pending idle wakeup, 0 while the animation frames run
+
+// Moves the decoded sounds into the mixer and mixes the frames the output needs
+void update_audio()
+{
+    for(int i = 0; i < MIXER_MAX_SOUNDS; ++i)
+    {
+        int channels, sampleRate;
+        if (mixer_is_sound_loaded(i))
+            continue;
+        if (int frames = decoded_audio_frames(i, &channels, &sampleRate))
+            copy_decoded_audio(i, mixer_load_sound(i, channels, frames, sampleRate));
+    }
+
+    static float left[2048], right[2048];
+    for(int frames = audio_frames_needed(idleTimeout ? IDLE_AUDIO_LEAD_MS : AUDIO_LEAD_MS); frames > 0;)
+    {
+        const int count = std::min(frames, 2048);
+        mixer_render(left, right, count);
+        submit_audio(left, right, count);
+        frames -= count;
+    }
+}
+
+void idle_tick(void* /* userData */);
+
+EM_BOOL game_tick(double t, void * /* userData */)
+{
+    game_frame(t);
+    if (!is_scene_static())
+    {
+        // right after the frame, so that its sounds start with the least latency
+        update_audio();
+        return EM_TRUE; // continue the loop
+    }
+    idleTimeout = emscripten_set_timeout(idle_tick, IDLE_INTERVAL_MS, nullptr);
+    update_audio();
+    return EM_FALSE;
+}
+
+void idle_tick(void* /* userData */)
+{
+    idleTimeout = 0;
+    game_frame(emscripten_get_now());
+    if (is_scene_static())
+        idleTimeout = emscripten_set_timeout(idle_tick, IDLE_INTERVAL_MS, nullptr);
+    else
+        emscripten_request_animation_frame_loop(&game_tick, nullptr);
+    update_audio();
+}
+
+// Brings back the animation frames if the game is idle
+void wake_up()
+{
+    if (!idleTimeout)
+        return;
+    emscripten_clear_timeout(idleTimeout);
+    idleTimeout = 0;
+    emscripten_request_animation_frame_loop(&game_tick, nullptr);
+}
+
+EM_BOOL KeyHandler(int eventType, const EmscriptenKeyboardEvent* keyEvent, void* /* userData */)
+{
+    Key key;
+    switch (emscripten_compute_dom_pk_code(keyEvent->code))
+    {
+    case DOM_PK_ENTER: key = KEY_ENTER; break;
+    case DOM_PK_SPACE: key = KEY_SPACE; break;
+    case DOM_PK_ARROW_UP: key = KEY_UP; break;
+    case DOM_PK_ARROW_DOWN: key = KEY_DOWN; break;
+    case DOM_PK_ARROW_LEFT: key = KEY_LEFT; break;
+    case DOM_PK_ARROW_RIGHT: key = KEY_RIGHT; break;
+    case DOM_PK_R: key = KEY_R; break;
+    case DOM_PK_P: key = KEY_P; break;
+    case DOM_PK_BACKSPACE: key = KEY_BACKSPACE; break;
+    default: return EM_FALSE;
+    }
+    key_event(key, eventType == EMSCRIPTEN_EVENT_KEYDOWN, keyEvent->timestamp);
+    wake_up();
+    return EM_FALSE; // don't suppress the key event
+}
+
+EM_BOOL TouchHandler(int eventType, const EmscriptenTouchEvent* touchEvent, void* /* userData */)
+{
+    switch (eventType)
+    {
+    case EMSCRIPTEN_EVENT_TOUCHSTART: touch_event(TOUCH_START, touchEvent->timestamp); break;
+    case EMSCRIPTEN_EVENT_TOUCHMOVE: touch_event(TOUCH_MOVE, touchEvent->timestamp); break;
+    case EMSCRIPTEN_EVENT_TOUCHEND: touch_event(TOUCH_END, touchEvent->timestamp); break;
+    case EMSCRIPTEN_EVENT_TOUCHCANCEL: touch_event(TOUCH_CANCEL, touchEvent->timestamp); break;
+    }
+    wake_up();
+    return EM_FALSE;
+}
+
+int main()
+{
+    gameSeed = (uint64_t)(emscripten_math_random() * 4294967296.0) << 32 | (uint64_t)(emscripten_math_random() * 4294967296.0);
+
+    init_webgl();
+    mixer_init(init_audio_output());
+    init_game();
+#ifdef BATCHASE_SIM_THREAD
+    start_simulation_thread();
+#endif
+    emscripten_request_animation_frame_loop(&game_tick, nullptr);
+
+    emscripten_set_keydown_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, KeyHandler);
+    emscripten_set_keyup_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, KeyHandler);
+
+    emscripten_set_resize_callback(EMSCRIPTEN_EVENT_TARGET_WINDOW, nullptr, EM_FALSE, ResizeHandler);
+
+    emscripten_set_touchstart_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, TouchHandler);
+    emscripten_set_touchmove_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, TouchHandler);
+    emscripten_set_touchend_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, TouchHandler);
+    emscripten_set_touchcancel_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, nullptr, EM_FALSE, TouchHandler);
+}
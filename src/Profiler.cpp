@@ -0,0 +1,94 @@
+#include "Profiler.h"
+
+#ifdef BATCHASE_PROFILER
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten/html5.h>
+#else
+#include <chrono>
+#endif
+
+// the frames as a ring buffer, frameIndex is the next one to write
+std::array<std::array<float, PHASE_NUM_PHASES>, PROFILE_FRAMES> profileFrames;
+int frameIndex, numFrames;
+// atomic: the simulation can run on its own thread
+std::array<std::atomic<double>, PHASE_NUM_PHASES> currentFrame;
+std::array<uint32_t, PROFILE_HISTOGRAM_BUCKETS> frameHistogram;
+
+const char* phaseNames[PHASE_NUM_PHASES] = { "frame", "simulation", "input", "traffic", "movement", "collision", "particles", "text", "render" };
+
+double profiler_now_ms()
+{
+#ifdef __EMSCRIPTEN__
+    return emscripten_performance_now();
+#else
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void profiler_add(ProfilePhase phase, double ms)
+{
+    currentFrame[phase].fetch_add(ms, std::memory_order_relaxed);
+}
+
+void profiler_end_frame(double intervalMs)
+{
+    for(int i = 0; i < PHASE_NUM_PHASES; ++i)
+        profileFrames[frameIndex][i] = (float)currentFrame[i].exchange(0.0, std::memory_order_relaxed);
+    frameIndex = (frameIndex + 1) % PROFILE_FRAMES;
+    numFrames = std::min(numFrames + 1, PROFILE_FRAMES);
+
+    int bucket = 0;
+    while (bucket < PROFILE_HISTOGRAM_BUCKETS - 1 && intervalMs > PROFILE_HISTOGRAM_EDGES_MS[bucket])
+        ++bucket;
+    ++frameHistogram[bucket];
+}
+
+const char* profiler_phase_name(ProfilePhase phase) { return phaseNames[phase]; }
+
+PhaseStats profiler_phase_stats(ProfilePhase phase)
+{
+    if (numFrames == 0)
+        return {};
+
+    std::array<float, PROFILE_FRAMES> samples;
+    double sum = 0.0;
+    for(int i = 0; i < numFrames; ++i)
+    {
+        samples[i] = profileFrames[i][phase];
+        sum += samples[i];
+    }
+    PhaseStats stats{ .minMs = *std::min_element(samples.begin(), samples.begin() + numFrames), .avgMs = float(sum / numFrames) };
+    auto p99 = samples.begin() + numFrames * 99 / 100;
+    std::nth_element(samples.begin(), p99, samples.begin() + numFrames);
+    stats.p99Ms = *p99;
+    return stats;
+}
+
+const uint32_t* profiler_frame_histogram() { return frameHistogram.data(); }
+
+void profiler_write_json(FILE* file)
+{
+    std::fprintf(file, "{\n  \"frames\": %d,\n  \"phases\": {\n", numFrames);
+    for(int i = 0; i < PHASE_NUM_PHASES; ++i)
+    {
+        PhaseStats stats = profiler_phase_stats((ProfilePhase)i);
+        std::fprintf(file, "    \"%s\": { \"min_ms\": %.4f, \"avg_ms\": %.4f, \"p99_ms\": %.4f }%s\n",
+            phaseNames[i], stats.minMs, stats.avgMs, stats.p99Ms, i + 1 < PHASE_NUM_PHASES ? "," : "");
+    }
+    std::fprintf(file, "  },\n  \"frame_interval_histogram\": [\n");
+    for(int i = 0; i < PROFILE_HISTOGRAM_BUCKETS; ++i)
+    {
+        if (i + 1 < PROFILE_HISTOGRAM_BUCKETS)
+            std::fprintf(file, "    { \"max_ms\": %g, \"frames\": %u },\n", PROFILE_HISTOGRAM_EDGES_MS[i], frameHistogram[i]);
+        else
+            std::fprintf(file, "    { \"max_ms\": null, \"frames\": %u }\n", frameHistogram[i]);
+    }
+    std::fprintf(file, "  ]\n}\n");
+}
+
+#endif
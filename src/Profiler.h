@@ -0,0 +1,66 @@
+// Frame profiler: scoped timers around the phases of a frame, kept for the last PROFILE_FRAMES frames.
+// Compiled in with -DBATCHASE_PROFILER, otherwise PROFILE_SCOPE() expands to nothing.
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+enum ProfilePhase
+{
+    PHASE_FRAME, // all of game_frame()
+    PHASE_SIMULATION, // all simulation ticks of the frame
+    PHASE_INPUT, // player controls in update_game()
+    PHASE_TRAFFIC, // the enemy cars following, braking and changing lanes
+    PHASE_MOVEMENT, // camera, spawning and moving the cars
+    PHASE_COLLISION,
+    PHASE_PARTICLES, // moving the sparks and the smoke
+    PHASE_TEXT, // formatting the HUD texts
+    PHASE_RENDER,
+    PHASE_NUM_PHASES
+};
+
+#ifdef BATCHASE_PROFILER
+
+constexpr int PROFILE_FRAMES = 512;
+// upper edges of the frame interval histogram buckets, the last bucket takes everything longer
+constexpr float PROFILE_HISTOGRAM_EDGES_MS[] = { 4.f, 8.f, 12.f, 17.f, 20.f, 25.f, 34.f, 50.f, 100.f };
+constexpr int PROFILE_HISTOGRAM_BUCKETS = sizeof(PROFILE_HISTOGRAM_EDGES_MS) / sizeof(float) + 1;
+
+struct PhaseStats
+{
+    float minMs, avgMs, p99Ms;
+};
+
+double profiler_now_ms();
+// Adds time to the phase in the current frame, a phase can be timed several times per frame
+void profiler_add(ProfilePhase phase, double ms);
+// Stores the current frame in the ring buffer. interval: time since the previous frame started
+void profiler_end_frame(double intervalMs);
+
+const char* profiler_phase_name(ProfilePhase phase);
+// over the frames in the ring buffer
+PhaseStats profiler_phase_stats(ProfilePhase phase);
+// frame intervals since the start
+const uint32_t* profiler_frame_histogram();
+void profiler_write_json(FILE* file);
+
+struct ProfileScope
+{
+    ProfilePhase phase;
+    double start;
+
+    explicit ProfileScope(ProfilePhase p) : phase(p), start(profiler_now_ms()) {}
+    ~ProfileScope() { profiler_add(phase, profiler_now_ms() - start); }
+};
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+#define PROFILE_SCOPE(phase) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(phase)
+#define PROFILE_END_FRAME(intervalMs) profiler_end_frame(intervalMs)
+
+#else
+
+#define PROFILE_SCOPE(phase) ((void)0)
+#define PROFILE_END_FRAME(intervalMs) ((void)(intervalMs))
+
+#endif
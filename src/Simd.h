@@ -0,0 +1,183 @@
+// 4-wide float vectors over SSE2, NEON and wasm SIMD128, and 8-wide 16-bit vectors for blending pixels. Defines
+// BATCHASE_SIMD when the target has one of them, -DBATCHASE_NO_SIMD leaves only the scalar code.
+#pragma once
+
+#include <cstdint>
+
+#if defined(BATCHASE_NO_SIMD)
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define BATCHASE_SIMD
+using f32x4 = v128_t;
+using m32x4 = v128_t;
+using u16x8 = v128_t;
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BATCHASE_SIMD
+using f32x4 = __m128;
+using m32x4 = __m128;
+using u16x8 = __m128i;
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BATCHASE_SIMD
+using f32x4 = float32x4_t;
+using m32x4 = uint32x4_t;
+using u16x8 = uint16x8_t;
+#endif
+
+#ifdef BATCHASE_SIMD
+
+#if defined(__wasm_simd128__)
+
+inline f32x4 f32x4_load(const float* p) { return wasm_v128_load(p); }
+inline f32x4 f32x4_load_i16(const int16_t* p) { return wasm_f32x4_convert_i32x4(wasm_i32x4_load16x4(p)); }
+inline void f32x4_store(float* p, f32x4 v) { wasm_v128_store(p, v); }
+inline f32x4 f32x4_splat(float f) { return wasm_f32x4_splat(f); }
+inline f32x4 f32x4_make(float a, float b, float c, float d) { return wasm_f32x4_make(a, b, c, d); }
+inline f32x4 f32x4_add(f32x4 a, f32x4 b) { return wasm_f32x4_add(a, b); }
+inline f32x4 f32x4_mul(f32x4 a, f32x4 b) { return wasm_f32x4_mul(a, b); }
+inline f32x4 f32x4_neg(f32x4 v) { return wasm_f32x4_neg(v); }
+inline f32x4 f32x4_abs(f32x4 v) { return wasm_f32x4_abs(v); }
+inline m32x4 f32x4_lt(f32x4 a, f32x4 b) { return wasm_f32x4_lt(a, b); }
+inline m32x4 f32x4_le(f32x4 a, f32x4 b) { return wasm_f32x4_le(a, b); }
+inline m32x4 m32x4_and(m32x4 a, m32x4 b) { return wasm_v128_and(a, b); }
+inline m32x4 m32x4_or(m32x4 a, m32x4 b) { return wasm_v128_or(a, b); }
+inline m32x4 m32x4_make(bool a, bool b, bool c, bool d) { return wasm_i32x4_make(-a, -b, -c, -d); }
+inline int m32x4_bits(m32x4 m) { return wasm_i32x4_bitmask(m); }
+// lanes where mask is set from a, the others from b
+inline f32x4 f32x4_select(m32x4 mask, f32x4 a, f32x4 b) { return wasm_v128_bitselect(a, b, mask); }
+// (x0 y0 x1 y1) (x2 y2 x3 y3) <-> (x0 x1 x2 x3) (y0 y1 y2 y3)
+inline void f32x4_deinterleave(f32x4 a, f32x4 b, f32x4& even, f32x4& odd)
+{
+    even = wasm_i32x4_shuffle(a, b, 0, 2, 4, 6);
+    odd = wasm_i32x4_shuffle(a, b, 1, 3, 5, 7);
+}
+inline void f32x4_interleave(f32x4 even, f32x4 odd, f32x4& a, f32x4& b)
+{
+    a = wasm_i32x4_shuffle(even, odd, 0, 4, 1, 5);
+    b = wasm_i32x4_shuffle(even, odd, 2, 6, 3, 7);
+}
+
+// 8 bytes, e.g. two RGBA pixels, widened to 16 bits and back
+inline u16x8 u16x8_load_u8(const uint8_t* p) { return wasm_u16x8_load8x8(p); }
+inline void u16x8_store_u8(uint8_t* p, u16x8 v) { wasm_v128_store64_lane(p, wasm_u8x16_narrow_i16x8(v, v), 0); }
+inline u16x8 u16x8_splat(uint16_t x) { return wasm_i16x8_splat(x); }
+inline u16x8 u16x8_make(uint16_t a, uint16_t b, uint16_t c, uint16_t d, uint16_t e, uint16_t f, uint16_t g, uint16_t h) { return wasm_u16x8_make(a, b, c, d, e, f, g, h); }
+inline u16x8 u16x8_add(u16x8 a, u16x8 b) { return wasm_i16x8_add(a, b); }
+inline u16x8 u16x8_sub(u16x8 a, u16x8 b) { return wasm_i16x8_sub(a, b); }
+inline u16x8 u16x8_mul(u16x8 a, u16x8 b) { return wasm_i16x8_mul(a, b); }
+inline u16x8 u16x8_or(u16x8 a, u16x8 b) { return wasm_v128_or(a, b); }
+inline u16x8 u16x8_shr8(u16x8 v) { return wasm_u16x8_shr(v, 8); }
+// lane 3 into lanes 0-3 and lane 7 into lanes 4-7: the alpha of two RGBA pixels
+inline u16x8 u16x8_splat_alpha(u16x8 v) { return wasm_i16x8_shuffle(v, v, 3, 3, 3, 3, 7, 7, 7, 7); }
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+inline f32x4 f32x4_load(const float* p) { return _mm_loadu_ps(p); }
+inline f32x4 f32x4_load_i16(const int16_t* p)
+{
+    const __m128i x = _mm_loadl_epi64((const __m128i*)p);
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+}
+inline void f32x4_store(float* p, f32x4 v) { _mm_storeu_ps(p, v); }
+inline f32x4 f32x4_splat(float f) { return _mm_set1_ps(f); }
+inline f32x4 f32x4_make(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+inline f32x4 f32x4_add(f32x4 a, f32x4 b) { return _mm_add_ps(a, b); }
+inline f32x4 f32x4_mul(f32x4 a, f32x4 b) { return _mm_mul_ps(a, b); }
+inline f32x4 f32x4_neg(f32x4 v) { return _mm_xor_ps(v, _mm_set1_ps(-0.f)); }
+inline f32x4 f32x4_abs(f32x4 v) { return _mm_andnot_ps(_mm_set1_ps(-0.f), v); }
+inline m32x4 f32x4_lt(f32x4 a, f32x4 b) { return _mm_cmplt_ps(a, b); }
+inline m32x4 f32x4_le(f32x4 a, f32x4 b) { return _mm_cmple_ps(a, b); }
+inline m32x4 m32x4_and(m32x4 a, m32x4 b) { return _mm_and_ps(a, b); }
+inline m32x4 m32x4_or(m32x4 a, m32x4 b) { return _mm_or_ps(a, b); }
+inline m32x4 m32x4_make(bool a, bool b, bool c, bool d) { return _mm_castsi128_ps(_mm_setr_epi32(-a, -b, -c, -d)); }
+inline int m32x4_bits(m32x4 m) { return _mm_movemask_ps(m); }
+inline f32x4 f32x4_select(m32x4 mask, f32x4 a, f32x4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+inline void f32x4_deinterleave(f32x4 a, f32x4 b, f32x4& even, f32x4& odd)
+{
+    even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    odd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+inline void f32x4_interleave(f32x4 even, f32x4 odd, f32x4& a, f32x4& b)
+{
+    a = _mm_unpacklo_ps(even, odd);
+    b = _mm_unpackhi_ps(even, odd);
+}
+
+inline u16x8 u16x8_load_u8(const uint8_t* p) { return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)p), _mm_setzero_si128()); }
+inline void u16x8_store_u8(uint8_t* p, u16x8 v) { _mm_storel_epi64((__m128i*)p, _mm_packus_epi16(v, v)); }
+inline u16x8 u16x8_splat(uint16_t x) { return _mm_set1_epi16(x); }
+inline u16x8 u16x8_make(uint16_t a, uint16_t b, uint16_t c, uint16_t d, uint16_t e, uint16_t f, uint16_t g, uint16_t h) { return _mm_setr_epi16(a, b, c, d, e, f, g, h); }
+inline u16x8 u16x8_add(u16x8 a, u16x8 b) { return _mm_add_epi16(a, b); }
+inline u16x8 u16x8_sub(u16x8 a, u16x8 b) { return _mm_sub_epi16(a, b); }
+inline u16x8 u16x8_mul(u16x8 a, u16x8 b) { return _mm_mullo_epi16(a, b); }
+inline u16x8 u16x8_or(u16x8 a, u16x8 b) { return _mm_or_si128(a, b); }
+inline u16x8 u16x8_shr8(u16x8 v) { return _mm_srli_epi16(v, 8); }
+inline u16x8 u16x8_splat_alpha(u16x8 v) { return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)); }
+
+#elif defined(__ARM_NEON)
+
+inline f32x4 f32x4_load(const float* p) { return vld1q_f32(p); }
+inline f32x4 f32x4_load_i16(const int16_t* p) { return vcvtq_f32_s32(vmovl_s16(vld1_s16(p))); }
+inline void f32x4_store(float* p, f32x4 v) { vst1q_f32(p, v); }
+inline f32x4 f32x4_splat(float f) { return vdupq_n_f32(f); }
+inline f32x4 f32x4_make(float a, float b, float c, float d) { const float v[4] = { a, b, c, d }; return vld1q_f32(v); }
+inline f32x4 f32x4_add(f32x4 a, f32x4 b) { return vaddq_f32(a, b); }
+inline f32x4 f32x4_mul(f32x4 a, f32x4 b) { return vmulq_f32(a, b); }
+inline f32x4 f32x4_neg(f32x4 v) { return vnegq_f32(v); }
+inline f32x4 f32x4_abs(f32x4 v) { return vabsq_f32(v); }
+inline m32x4 f32x4_lt(f32x4 a, f32x4 b) { return vcltq_f32(a, b); }
+inline m32x4 f32x4_le(f32x4 a, f32x4 b) { return vcleq_f32(a, b); }
+inline m32x4 m32x4_and(m32x4 a, m32x4 b) { return vandq_u32(a, b); }
+inline m32x4 m32x4_or(m32x4 a, m32x4 b) { return vorrq_u32(a, b); }
+inline m32x4 m32x4_make(bool a, bool b, bool c, bool d) { const uint32_t v[4] = { 0u - a, 0u - b, 0u - c, 0u - d }; return vld1q_u32(v); }
+inline int m32x4_bits(m32x4 m)
+{
+    const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+    return vaddvq_u32(vandq_u32(m, vld1q_u32(laneBits)));
+}
+inline f32x4 f32x4_select(m32x4 mask, f32x4 a, f32x4 b) { return vbslq_f32(mask, a, b); }
+inline void f32x4_deinterleave(f32x4 a, f32x4 b, f32x4& even, f32x4& odd)
+{
+    float32x4x2_t r = vuzpq_f32(a, b);
+    even = r.val[0];
+    odd = r.val[1];
+}
+inline void f32x4_interleave(f32x4 even, f32x4 odd, f32x4& a, f32x4& b)
+{
+    float32x4x2_t r = vzipq_f32(even, odd);
+    a = r.val[0];
+    b = r.val[1];
+}
+
+inline u16x8 u16x8_load_u8(const uint8_t* p) { return vmovl_u8(vld1_u8(p)); }
+inline void u16x8_store_u8(uint8_t* p, u16x8 v) { vst1_u8(p, vmovn_u16(v)); }
+inline u16x8 u16x8_splat(uint16_t x) { return vdupq_n_u16(x); }
+inline u16x8 u16x8_make(uint16_t a, uint16_t b, uint16_t c, uint16_t d, uint16_t e, uint16_t f, uint16_t g, uint16_t h) { const uint16_t v[8] = { a, b, c, d, e, f, g, h }; return vld1q_u16(v); }
+inline u16x8 u16x8_add(u16x8 a, u16x8 b) { return vaddq_u16(a, b); }
+inline u16x8 u16x8_sub(u16x8 a, u16x8 b) { return vsubq_u16(a, b); }
+inline u16x8 u16x8_mul(u16x8 a, u16x8 b) { return vmulq_u16(a, b); }
+inline u16x8 u16x8_or(u16x8 a, u16x8 b) { return vorrq_u16(a, b); }
+inline u16x8 u16x8_shr8(u16x8 v) { return vshrq_n_u16(v, 8); }
+inline u16x8 u16x8_splat_alpha(u16x8 v)
+{
+    const uint8_t alphaBytes[16] = { 6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15 };
+    return vreinterpretq_u16_u8(vqtbl1q_u8(vreinterpretq_u8_u16(v), vld1q_u8(alphaBytes)));
+}
+
+#endif
+
+// same as std::clamp(v, lo, hi) lane by lane
+inline f32x4 f32x4_clamp(f32x4 v, f32x4 lo, f32x4 hi)
+{
+    return f32x4_select(f32x4_lt(v, lo), lo, f32x4_select(f32x4_lt(hi, v), hi, v));
+}
+
+// x / 255 rounded to the nearest, exact for x <= 255 * 255
+inline u16x8 u16x8_div255(u16x8 x)
+{
+    x = u16x8_add(x, u16x8_splat(128));
+    return u16x8_shr8(u16x8_add(x, u16x8_shr8(x)));
+}
+
+#endif
@@ -0,0 +1,457 @@
+#include "SoftGL.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+bool softGLEnabled;
+bool softGLRasterize = true;
+#ifdef BATCHASE_SIMD
+bool softGLUseSimd = true;
+#else
+bool softGLUseSimd = false; // the target has no SIMD instructions
+#endif
+
+struct Texture
+{
+    std::vector<uint32_t> pixels; // RGBA8, the row at t = 0 first
+    std::vector<uint8_t> indices; // R8 instead, into the palette
+    int width, height;
+};
+
+// Indexed by the GL names, which the null GL hands out from a single counter. textures grows only when one is bound
+// or attached, so that the references to them stay valid otherwise.
+std::vector<Texture> textures;
+std::vector<GLuint> framebufferTextures; // the texture attached to each framebuffer, 0 for none
+std::vector<std::vector<uint8_t>> buffers;
+Texture screen; // the default framebuffer
+
+GLuint unitTextures[2], boundArrayBuffer, drawFramebuffer; // the textures bound to units 0 and 1
+int activeUnit;
+bool blending;
+float pixelSize[2];
+int viewport[4];
+uint32_t clearColor;
+
+// Where the per-instance attributes of the sprite program are read from: 1 rect, 2 uvRect and 3 color
+struct InstanceAttribute
+{
+    GLuint buffer;
+    size_t offset;
+    GLsizei stride;
+};
+InstanceAttribute instanceAttributes[4];
+
+template <typename T>
+T& by_name(std::vector<T>& objects, GLuint name)
+{
+    if (name >= objects.size())
+        objects.resize(name + 1);
+    return objects[name];
+}
+
+Texture& framebuffer_texture(GLuint framebuffer)
+{
+    return framebuffer ? textures[by_name(framebufferTextures, framebuffer)] : screen;
+}
+
+void soft_gl_init(int width, int height)
+{
+    screen.width = width;
+    screen.height = height;
+    screen.pixels.assign(size_t(width) * height, 0);
+    viewport[2] = width;
+    viewport[3] = height;
+    textures.resize(1);
+    softGLEnabled = true;
+}
+
+const uint8_t* soft_gl_pixels() { return (const uint8_t*)screen.pixels.data(); }
+
+// A sprite instance in pixels of the target
+struct Quad
+{
+    int x0, y0, x1, y1; // the pixels covered, clipped to the viewport and the target
+    int32_t s, t, ds, dt; // the texel at the center of pixel (x0, y0) and the step per pixel, 16.16 fixed point
+    uint8_t tint[4];
+};
+
+std::vector<Quad> quads;
+const Texture* jobTexture;
+const uint32_t* jobPalette; // 256 colours for an index texture
+Texture* jobTarget;
+bool jobBlending;
+
+// x / 255 rounded, like u16x8_div255()
+inline int div255(int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// dst = tint * src, blended over dst with SRC_ALPHA, ONE_MINUS_SRC_ALPHA for the colour and ONE,
+// ONE_MINUS_SRC_ALPHA for the alpha like init_renderer() sets up
+void blit_row(uint32_t* dst, const uint32_t* src, int n, const uint8_t tint[4], bool blend)
+{
+    const bool tinted = (tint[0] & tint[1] & tint[2] & tint[3]) != 255;
+    if (!blend && !tinted)
+    {
+        std::memcpy(dst, src, n * sizeof(uint32_t));
+        return;
+    }
+    uint8_t* d = (uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+    int i = 0;
+#ifdef BATCHASE_SIMD
+    if (softGLUseSimd)
+    {
+        const u16x8 tint2 = u16x8_make(tint[0], tint[1], tint[2], tint[3], tint[0], tint[1], tint[2], tint[3]);
+        const u16x8 alphaOne = u16x8_make(0, 0, 0, 255, 0, 0, 0, 255), full = u16x8_splat(255);
+        // two pixels at a time
+        for(; i + 2 <= n; i += 2)
+        {
+            u16x8 c = u16x8_load_u8(s + 4 * i);
+            if (tinted)
+                c = u16x8_div255(u16x8_mul(c, tint2));
+            if (blend)
+            {
+                const u16x8 a = u16x8_splat_alpha(c);
+                c = u16x8_div255(u16x8_add(u16x8_mul(c, u16x8_or(a, alphaOne)), u16x8_mul(u16x8_load_u8(d + 4 * i), u16x8_sub(full, a))));
+            }
+            u16x8_store_u8(d + 4 * i, c);
+        }
+    }
+#endif
+    for(; i < n; ++i)
+    {
+        uint8_t c[4];
+        for(int k = 0; k < 4; ++k)
+            c[k] = tinted ? div255(s[4 * i + k] * tint[k]) : s[4 * i + k];
+        if (blend)
+        {
+            const int a = c[3];
+            for(int k = 0; k < 3; ++k)
+                c[k] = div255(c[k] * a + d[4 * i + k] * (255 - a));
+            c[3] = div255(c[3] * 255 + d[4 * i + 3] * (255 - a));
+        }
+        std::memcpy(d + 4 * i, c, 4);
+    }
+}
+
+void draw_row(const Quad& q, int y)
+{
+    const Texture& texture = *jobTexture;
+    const int texelY = (int)std::clamp<int64_t>((q.t + int64_t(y - q.y0) * q.dt) >> 16, 0, texture.height - 1);
+    uint32_t* dst = jobTarget->pixels.data() + size_t(y) * jobTarget->width + q.x0;
+    const int n = q.x1 - q.x0, texelX = q.s >> 16;
+    // the sprites are drawn at their size, straight from the texture
+    const bool unscaled = q.ds == 1 << 16 && texelX >= 0 && texelX + n <= texture.width;
+    uint32_t texels[256];
+    if (!texture.indices.empty())
+    {
+        // the colours of the indices first
+        const uint8_t* row = texture.indices.data() + size_t(texelY) * texture.width;
+        for(int i = 0; i < n; i += 256)
+        {
+            const int count = std::min(n - i, 256);
+            if (unscaled)
+                for(int j = 0; j < count; ++j)
+                    texels[j] = jobPalette[row[texelX + i + j]];
+            else
+                for(int j = 0; j < count; ++j)
+                    texels[j] = jobPalette[row[std::clamp<int64_t>((q.s + int64_t(i + j) * q.ds) >> 16, 0, texture.width - 1)]];
+            blit_row(dst + i, texels, count, q.tint, jobBlending);
+        }
+        return;
+    }
+    const uint32_t* row = texture.pixels.data() + size_t(texelY) * texture.width;
+    if (unscaled)
+    {
+        blit_row(dst, row + texelX, n, q.tint, jobBlending);
+        return;
+    }
+    // scaled, or running over the edge: gather the texels first
+    for(int i = 0; i < n; i += 256)
+    {
+        const int count = std::min(n - i, 256);
+        for(int j = 0; j < count; ++j)
+            texels[j] = row[std::clamp<int64_t>((q.s + int64_t(i + j) * q.ds) >> 16, 0, texture.width - 1)];
+        blit_row(dst + i, texels, count, q.tint, jobBlending);
+    }
+}
+
+// The rows of the quads in the tiles of this thread, in the order of the quads
+void rasterize_tiles(int thread, int threads)
+{
+    for(const Quad& q : quads)
+    {
+        // the first tile of this thread from the quad's first row on
+        int tile = q.y0 / SOFT_GL_TILE_ROWS;
+        tile += ((thread - tile) % threads + threads) % threads;
+        for(; tile * SOFT_GL_TILE_ROWS < q.y1; tile += threads)
+        {
+            const int y1 = std::min(q.y1, (tile + 1) * SOFT_GL_TILE_ROWS);
+            for(int y = std::max(q.y0, tile * SOFT_GL_TILE_ROWS); y < y1; ++y)
+                draw_row(q, y);
+        }
+    }
+}
+
+// The workers wait for jobGeneration to change, rasterize their tiles and count jobsRunning down
+int numThreads = 1;
+std::atomic<uint32_t> jobGeneration;
+std::atomic<int> jobsRunning;
+bool stopWorkers;
+
+void run_worker(int thread, uint32_t generation)
+{
+    for(;;)
+    {
+        jobGeneration.wait(generation, std::memory_order_acquire);
+        generation = jobGeneration.load(std::memory_order_acquire);
+        if (stopWorkers)
+            return;
+        rasterize_tiles(thread, numThreads);
+        if (jobsRunning.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            jobsRunning.notify_one();
+    }
+}
+
+struct Workers
+{
+    std::vector<std::thread> threads;
+
+    void stop()
+    {
+        stopWorkers = true;
+        jobGeneration.fetch_add(1, std::memory_order_release);
+        jobGeneration.notify_all();
+        for(std::thread& thread : threads)
+            thread.join();
+        threads.clear();
+        stopWorkers = false;
+    }
+
+    ~Workers() { stop(); }
+} workers;
+
+void soft_gl_set_threads(int threads)
+{
+    threads = std::max(threads, 1);
+    if (threads == numThreads)
+        return;
+    workers.stop();
+    numThreads = threads;
+    for(int i = 1; i < threads; ++i)
+        workers.threads.emplace_back(run_worker, i, jobGeneration.load(std::memory_order_relaxed));
+}
+
+void rasterize(const Texture& texture, const Texture& palette, Texture& target)
+{
+    jobTexture = &texture;
+    jobPalette = palette.pixels.data();
+    jobTarget = &target;
+    jobBlending = blending;
+    if (workers.threads.empty())
+    {
+        rasterize_tiles(0, 1);
+        return;
+    }
+    jobsRunning.store(workers.threads.size(), std::memory_order_relaxed);
+    jobGeneration.fetch_add(1, std::memory_order_release);
+    jobGeneration.notify_all();
+    rasterize_tiles(0, numThreads);
+    for(int running; (running = jobsRunning.load(std::memory_order_acquire)) > 0;)
+        jobsRunning.wait(running, std::memory_order_acquire);
+}
+
+// Pixels [p0, p1[ of an axis whose centers are between the edges e0 and e1, clipped to [lo, hi[, and the texel
+// coordinate at the center of p0 and its step per pixel, for texture coordinates from uv to uv + uvSize between
+// the edges
+bool setup_axis(double e0, double e1, int lo, int hi, double uv, double uvSize, int texels, int& p0, int& p1, int32_t& s, int32_t& ds)
+{
+    p0 = (int)std::clamp(std::ceil(e0 - 0.5), (double)lo, (double)hi);
+    p1 = (int)std::clamp(std::ceil(e1 - 0.5), (double)lo, (double)hi);
+    if (p0 >= p1)
+        return false;
+    const double texelsPerPixel = uvSize * texels / (e1 - e0);
+    s = (int32_t)std::floor((uv * texels + (p0 + 0.5 - e0) * texelsPerPixel) * 65536.0);
+    ds = (int32_t)std::lround(texelsPerPixel * 65536.0);
+    return true;
+}
+
+// Attribute index of instance, nullptr if the buffer doesn't have it
+const void* instance_attribute(int index, GLsizei instance, size_t size)
+{
+    const InstanceAttribute& a = instanceAttributes[index];
+    const std::vector<uint8_t>& buffer = by_name(buffers, a.buffer);
+    const size_t offset = a.offset + size_t(instance) * (a.stride ? a.stride : size);
+    return offset + size <= buffer.size() ? buffer.data() + offset : nullptr;
+}
+
+void soft_gl_draw_arrays_instanced(GLenum mode, GLint /* first */, GLsizei count, GLsizei instances)
+{
+    // the unit quad of init_renderer() as a strip
+    if (!softGLRasterize || mode != GL_TRIANGLE_STRIP || count != 4)
+        return;
+    const Texture& texture = textures[unitTextures[0]];
+    const Texture& palette = textures[unitTextures[1]];
+    Texture& target = framebuffer_texture(drawFramebuffer);
+    if ((texture.pixels.empty() && (texture.indices.empty() || palette.pixels.size() < 256)) || &texture == &target)
+        return;
+
+    const int left = std::max(viewport[0], 0), right = std::min(viewport[0] + viewport[2], target.width);
+    const int bottom = std::max(viewport[1], 0), top = std::min(viewport[1] + viewport[3], target.height);
+    // pixels of the target per unit of the rectangles: gl_Position = rect * pixelSize - 1
+    const double scaleX = pixelSize[0] * viewport[2] * 0.5, scaleY = pixelSize[1] * viewport[3] * 0.5;
+    quads.clear();
+    for(GLsizei i = 0; i < instances; ++i)
+    {
+        const float* rect = (const float*)instance_attribute(1, i, 4 * sizeof(float));
+        const float* uv = (const float*)instance_attribute(2, i, 4 * sizeof(float));
+        const uint8_t* color = (const uint8_t*)instance_attribute(3, i, 4);
+        if (!rect || !uv || !color)
+            break;
+        Quad q;
+        std::memcpy(q.tint, color, 4);
+        if (setup_axis(viewport[0] + rect[0] * scaleX, viewport[0] + (rect[0] + rect[2]) * scaleX, left, right, uv[0], uv[2], texture.width, q.x0, q.x1, q.s, q.ds) &&
+            setup_axis(viewport[1] + rect[1] * scaleY, viewport[1] + (rect[1] + rect[3]) * scaleY, bottom, top, uv[1], uv[3], texture.height, q.y0, q.y1, q.t, q.dt))
+            quads.push_back(q);
+    }
+    if (!quads.empty())
+        rasterize(texture, palette, target);
+}
+
+void soft_gl_set_capability(GLenum cap, bool enabled)
+{
+    if (cap == GL_BLEND)
+        blending = enabled;
+}
+
+// the sprite program has one uniform, pixelSize
+void soft_gl_uniform2f(GLint /* location */, GLfloat x, GLfloat y)
+{
+    pixelSize[0] = x;
+    pixelSize[1] = y;
+}
+
+void soft_gl_viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    viewport[0] = x;
+    viewport[1] = y;
+    viewport[2] = width;
+    viewport[3] = height;
+}
+
+void soft_gl_clear_color(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+    uint8_t bytes[4];
+    const GLfloat color[4] = { r, g, b, a };
+    for(int i = 0; i < 4; ++i)
+        bytes[i] = (uint8_t)std::lround(std::clamp(color[i], 0.f, 1.f) * 255.f);
+    std::memcpy(&clearColor, bytes, 4);
+}
+
+void soft_gl_clear(GLbitfield mask)
+{
+    if (!softGLRasterize || !(mask & GL_COLOR_BUFFER_BIT))
+        return;
+    Texture& target = framebuffer_texture(drawFramebuffer);
+    std::fill(target.pixels.begin(), target.pixels.end(), clearColor);
+}
+
+void soft_gl_bind_buffer(GLenum target, GLuint buffer)
+{
+    if (target == GL_ARRAY_BUFFER)
+        boundArrayBuffer = buffer;
+}
+
+void soft_gl_buffer_data(GLenum target, GLsizeiptr size, const void* data)
+{
+    if (!softGLRasterize || target != GL_ARRAY_BUFFER)
+        return;
+    std::vector<uint8_t>& buffer = by_name(buffers, boundArrayBuffer);
+    if (data)
+        buffer.assign((const uint8_t*)data, (const uint8_t*)data + size);
+    else
+        buffer.assign(size, 0);
+}
+
+void soft_gl_vertex_attrib_pointer(GLuint index, GLsizei stride, const void* offset)
+{
+    if (index < 4)
+        instanceAttributes[index] = { boundArrayBuffer, (size_t)offset, stride };
+}
+
+void soft_gl_delete_textures(GLsizei n, const GLuint* names)
+{
+    for(GLsizei i = 0; i < n; ++i)
+        by_name(textures, names[i]) = {};
+}
+
+void soft_gl_active_texture(GLenum unit)
+{
+    activeUnit = unit == GL_TEXTURE1;
+}
+
+void soft_gl_bind_texture(GLenum /* target */, GLuint texture)
+{
+    by_name(textures, texture);
+    unitTextures[activeUnit] = texture;
+}
+
+void soft_gl_tex_storage_2d(GLenum internalFormat, GLsizei width, GLsizei height)
+{
+    Texture& texture = textures[unitTextures[activeUnit]];
+    texture.width = width;
+    texture.height = height;
+    if (internalFormat == GL_R8)
+    {
+        texture.indices.assign(size_t(width) * height, 0);
+        texture.pixels.clear();
+    }
+    else
+    {
+        texture.pixels.assign(size_t(width) * height, 0);
+        texture.indices.clear();
+    }
+}
+
+// Copies width x height texels to (x, y) of a texture's texels, leaving out what falls outside it. The rows of
+// src are tightly packed, like the renderer uploads them with an unpack alignment of 1.
+template <typename T>
+void copy_rect(std::vector<T>& dst, int dstWidth, int dstHeight, int x, int y, const T* src, int width, int height)
+{
+    const int left = std::max(0, -x), right = std::min(width, dstWidth - x);
+    const int bottom = std::max(0, -y), top = std::min(height, dstHeight - y);
+    for(int row = bottom; row < top && left < right; ++row)
+        std::memcpy(dst.data() + size_t(y + row) * dstWidth + x + left, src + size_t(row) * width + left, (right - left) * sizeof(T));
+}
+
+void soft_gl_tex_sub_image_2d(GLint x, GLint y, GLsizei width, GLsizei height, const void* pixels)
+{
+    Texture& texture = textures[unitTextures[activeUnit]];
+    if (!texture.indices.empty())
+        copy_rect(texture.indices, texture.width, texture.height, x, y, (const uint8_t*)pixels, width, height);
+    else
+        copy_rect(texture.pixels, texture.width, texture.height, x, y, (const uint32_t*)pixels, width, height);
+}
+
+void soft_gl_bind_framebuffer(GLenum target, GLuint framebuffer)
+{
+    if (target != GL_READ_FRAMEBUFFER)
+        drawFramebuffer = framebuffer;
+}
+
+// only draw framebuffers are used
+void soft_gl_framebuffer_texture_2d(GLenum /* target */, GLuint texture)
+{
+    const GLuint framebuffer = drawFramebuffer;
+    by_name(textures, texture);
+    if (framebuffer)
+        by_name(framebufferTextures, framebuffer) = texture;
+}
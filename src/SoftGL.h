@@ -0,0 +1,45 @@
+// Software rasterizer behind the null GL (NullGL.cpp), for seeing what the renderer draws without a GPU, e.g. for
+// golden-image tests. Once soft_gl_init() has been called the GL calls draw into a CPU framebuffer.
+// It implements what the renderer uses of GLES 3 and no more: RGBA8 and R8 textures sampled nearest with the
+// coordinates clamped to the edge, framebuffers with an RGBA texture attached, and instanced quads drawn with the
+// sprite program of init_renderer() (a rectangle, a UV rectangle and a tint per instance, tint * texture) and its
+// blend function. Like the program's indexed uniform, an R8 texture is looked up in the palette on texture unit 1.
+// The rows of the target are dealt out in tiles to the threads, each row is blended with SIMD kernels.
+#pragma once
+
+#include <GLES3/gl3.h>
+
+#include <cstdint>
+
+// rows of a tile, the tiles go round the threads
+constexpr int SOFT_GL_TILE_ROWS = 16;
+
+// Allocates the default framebuffer. Call before init_game(), so that the textures are kept from the start.
+void soft_gl_init(int width, int height);
+// The default framebuffer, width * height RGBA pixels with the bottom row first like glReadPixels() gives them
+const uint8_t* soft_gl_pixels();
+// Threads that rasterize a draw, the calling one included
+void soft_gl_set_threads(int threads);
+
+extern bool softGLEnabled; // set by soft_gl_init()
+// false skips the draws and clears but keeps the textures, for timing the rest of the renderer
+extern bool softGLRasterize;
+extern bool softGLUseSimd; // the row kernels, when the target has SIMD instructions
+
+// The GL calls NullGL.cpp forwards while enabled
+void soft_gl_set_capability(GLenum cap, bool enabled);
+void soft_gl_uniform2f(GLint location, GLfloat x, GLfloat y);
+void soft_gl_viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void soft_gl_clear_color(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+void soft_gl_clear(GLbitfield mask);
+void soft_gl_bind_buffer(GLenum target, GLuint buffer);
+void soft_gl_buffer_data(GLenum target, GLsizeiptr size, const void* data);
+void soft_gl_vertex_attrib_pointer(GLuint index, GLsizei stride, const void* offset);
+void soft_gl_draw_arrays_instanced(GLenum mode, GLint first, GLsizei count, GLsizei instances);
+void soft_gl_delete_textures(GLsizei n, const GLuint* textures);
+void soft_gl_active_texture(GLenum unit);
+void soft_gl_bind_texture(GLenum target, GLuint texture);
+void soft_gl_tex_storage_2d(GLenum internalFormat, GLsizei width, GLsizei height);
+void soft_gl_tex_sub_image_2d(GLint x, GLint y, GLsizei width, GLsizei height, const void* pixels);
+void soft_gl_bind_framebuffer(GLenum target, GLuint framebuffer);
+void soft_gl_framebuffer_texture_2d(GLenum target, GLuint texture);